@@ -6,6 +6,8 @@
 #include "esphome/core/defines.h"
 #include "esphome/core/hal.h"
 
+#include <vector>
+
 #ifdef USE_ESP32
 #include <esp_adc_cal.h>
 #include "driver/adc.h"
@@ -55,6 +57,8 @@ class ADCSensor : public sensor::Sensor, public PollingComponent, public voltage
   void set_pin(InternalGPIOPin *pin) { this->pin_ = pin; }
   void set_output_raw(bool output_raw) { this->output_raw_ = output_raw; }
   void set_sample_count(uint8_t sample_count);
+  /// Run every one of the samples through the filters instead of publishing their average.
+  void set_filter_samples(bool filter_samples) { this->filter_samples_ = filter_samples; }
   float sample() override;
 
 #ifdef USE_ESP8266
@@ -69,6 +73,11 @@ class ADCSensor : public sensor::Sensor, public PollingComponent, public voltage
   InternalGPIOPin *pin_;
   bool output_raw_{false};
   uint8_t sample_count_{1};
+  bool filter_samples_{false};
+  std::vector<float> samples_;
+
+  /// Read the pin sample_count times and return the average.
+  float read_average_(uint8_t sample_count);
 
 #ifdef USE_RP2040
   bool is_temperature_{false};
@@ -4,12 +4,14 @@ from esphome import automation, core
 from esphome.components import font
 import esphome.components.image as espImage
 from esphome.components.image import (
+    CONF_COMPRESS,
     CONF_USE_TRANSPARENCY,
     LOCAL_SCHEMA,
     WEB_SCHEMA,
     SOURCE_WEB,
     SOURCE_LOCAL,
 )
+from esphome.components.image.compression import compress_animation, unit_size
 import esphome.config_validation as cv
 import esphome.codegen as cg
 from esphome.const import (
@@ -118,6 +120,7 @@ ANIMATION_SCHEMA = cv.Schema(
             # Not setting default here on purpose; the default depends on the image type,
             # and thus will be set in the "validate_cross_dependencies" validator.
             cv.Optional(CONF_USE_TRANSPARENCY): cv.boolean,
+            cv.Optional(CONF_COMPRESS, default=False): cv.boolean,
             cv.Optional(CONF_LOOP): cv.All(
                 {
                     cv.Optional(CONF_START_FRAME, default=0): cv.positive_int,
@@ -325,6 +328,20 @@ async def to_code(config):
             f"Animation f{config[CONF_ID]} has not supported type {config[CONF_TYPE]}."
         )
 
+    compress = config[CONF_COMPRESS]
+    if compress:
+        raw_size = len(data)
+        data = compress_animation(
+            data,
+            raw_size // (height * frames),
+            height,
+            frames,
+            unit_size(config[CONF_TYPE]),
+        )
+        _LOGGER.debug(
+            "%s compressed from %d to %d bytes", config[CONF_ID], raw_size, len(data)
+        )
+
     rhs = [HexInt(x) for x in data]
     prog_arr = cg.progmem_array(config[CONF_RAW_DATA_ID], rhs)
     var = cg.new_Pvariable(
@@ -336,6 +353,8 @@ async def to_code(config):
         espImage.IMAGE_TYPE[config[CONF_TYPE]],
     )
     cg.add(var.set_transparency(transparent))
+    if compress:
+        cg.add(var.set_compressed(True))
     if loop_config := config.get(CONF_LOOP):
         start = loop_config[CONF_START_FRAME]
         end = loop_config.get(CONF_END_FRAME, frames)
@@ -1,10 +1,18 @@
 #include "animation.h"
 
+#include <algorithm>
+
 #include "esphome/core/hal.h"
+#include "esphome/core/log.h"
 
 namespace esphome {
 namespace animation {
 
+static const char *const TAG = "animation";
+
+/// Set in the frame table of compressed animations for frames that don't depend on the frame before.
+static const uint32_t KEY_FRAME_FLAG = 0x80000000;
+
 Animation::Animation(const uint8_t *data_start, int width, int height, uint32_t animation_frame_count,
                      image::ImageType type)
     : Image(data_start, width, height, type),
@@ -62,9 +70,36 @@ void Animation::set_frame(int frame) {
 }
 
 void Animation::update_data_start_() {
+  if (this->compressed_) {
+    this->data_start_ = this->animation_data_start_ + (this->get_frame_entry_(this->current_frame_) & ~KEY_FRAME_FLAG);
+    return;
+  }
   const uint32_t image_size = image_type_to_width_stride(this->width_, this->type_) * this->height_;
   this->data_start_ = this->animation_data_start_ + image_size * this->current_frame_;
 }
 
+uint32_t Animation::get_frame_entry_(int frame) const {
+  const uint8_t *entry = this->animation_data_start_ + frame * 4;
+  return progmem_read_byte(entry) | (progmem_read_byte(entry + 1) << 8) | (progmem_read_byte(entry + 2) << 16) |
+         (uint32_t(progmem_read_byte(entry + 3)) << 24);
+}
+
+size_t Animation::get_row_decoders_(image::RowDecoder *decoders) const {
+  // Delta frames are applied on top of the frames before them, back to the last key frame
+  size_t count = 0;
+  for (int frame = this->current_frame_; frame >= 0; frame--) {
+    if (count == image::MAX_ROW_DECODERS) {
+      ESP_LOGE(TAG, "Frame %d depends on too many frames", this->current_frame_);
+      return 0;
+    }
+    const uint32_t entry = this->get_frame_entry_(frame);
+    decoders[count++] = this->make_row_decoder_(this->animation_data_start_ + (entry & ~KEY_FRAME_FLAG));
+    if (entry & KEY_FRAME_FLAG)
+      break;
+  }
+  std::reverse(decoders, decoders + count);
+  return count;
+}
+
 }  // namespace animation
 }  // namespace esphome
@@ -25,6 +25,9 @@ class Animation : public image::Image {
 
  protected:
   void update_data_start_();
+  /// The frame table entry of a compressed animation: the offset of the frame's data and whether it's a key frame.
+  uint32_t get_frame_entry_(int frame) const;
+  size_t get_row_decoders_(image::RowDecoder *decoders) const override;
 
   const uint8_t *animation_data_start_;
   int current_frame_;
@@ -52,6 +52,7 @@ void APIConnection::start() {
   this->client_info_ = helper_->getpeername();
   this->client_peername_ = this->client_info_;
   this->helper_->set_log_info(this->client_info_);
+  this->helper_->set_coalesce_writes(this->parent_->get_batch_delay() != 0);
 }
 
 APIConnection::~APIConnection() {
@@ -79,7 +80,8 @@ void APIConnection::loop() {
     return;
   }
   if (this->next_close_) {
-    // requested a disconnect
+    // requested a disconnect, write out whatever is still queued first
+    this->helper_->flush();
     this->helper_->close();
     this->remove_ = true;
     return;
@@ -92,8 +94,26 @@ void APIConnection::loop() {
              api_error_to_str(err), errno);
     return;
   }
+  if (this->parent_->get_batch_delay() != 0 && this->helper_->has_pending_writes()) {
+    const uint32_t now = millis();
+    if (!this->batch_pending_) {
+      this->batch_pending_ = true;
+      this->batch_started_ = now;
+    } else if (now - this->batch_started_ >= this->parent_->get_batch_delay()) {
+      err = this->helper_->flush();
+      if (err != APIError::OK) {
+        on_fatal_error();
+        ESP_LOGW(TAG, "%s: Socket write failed: %s errno=%d", this->client_combined_info_.c_str(),
+                 api_error_to_str(err), errno);
+        return;
+      }
+      // If the socket didn't take everything, the rest goes out with the next batch
+      this->batch_pending_ = false;
+    }
+  }
   ReadPacketBuffer buffer;
-  err = this->helper_->read_packet(&buffer);
+  // Skip the read syscall when the main loop already knows nothing arrived
+  err = this->helper_->is_socket_ready() ? this->helper_->read_packet(&buffer) : APIError::WOULD_BLOCK;
   if (err == APIError::WOULD_BLOCK) {
     // pass
   } else if (err != APIError::OK) {
@@ -1345,6 +1365,33 @@ void APIConnection::update_command(const UpdateCommandRequest &msg) {
 }
 #endif
 
+#ifdef USE_COMPONENT_RUNTIME_STATS
+ComponentRuntimeStatsResponse APIConnection::component_runtime_stats(const ComponentRuntimeStatsRequest &msg) {
+  ComponentRuntimeStatsResponse resp;
+  const std::vector<Component *> &components = App.get_components();
+  resp.components.reserve(components.size());
+  for (Component *component : components) {
+    const ComponentRuntimeStats &loop = component->get_loop_stats();
+    const ComponentRuntimeStats &sched = component->get_scheduler_stats();
+    ComponentRuntimeStatsEntry entry;
+    entry.component = component->get_component_source();
+    entry.setup_us = component->get_setup_time_us();
+    entry.loop_count = loop.count;
+    entry.loop_total_us = loop.total_us;
+    entry.loop_max_us = loop.max_us;
+    entry.loop_buckets.assign(loop.buckets, loop.buckets + ComponentRuntimeStats::NUM_BUCKETS);
+    entry.scheduler_count = sched.count;
+    entry.scheduler_total_us = sched.total_us;
+    entry.scheduler_max_us = sched.max_us;
+    entry.scheduler_buckets.assign(sched.buckets, sched.buckets + ComponentRuntimeStats::NUM_BUCKETS);
+    resp.components.push_back(std::move(entry));
+    if (msg.reset)
+      component->reset_runtime_stats();
+  }
+  return resp;
+}
+#endif
+
 bool APIConnection::send_log_message(int level, const char *tag, const char *line) {
   if (this->log_subscription_ < level)
     return false;
@@ -1480,7 +1527,7 @@ bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type)
     }
   }
 
-  APIError err = this->helper_->write_packet(message_type, buffer.get_buffer()->data(), buffer.get_buffer()->size());
+  APIError err = this->helper_->write_protobuf_packet(message_type, buffer);
   if (err == APIError::WOULD_BLOCK)
     return false;
   if (err != APIError::OK) {
@@ -1493,6 +1540,10 @@ bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type)
     }
     return false;
   }
+  if (!this->batch_pending_ && this->helper_->has_pending_writes()) {
+    this->batch_pending_ = true;
+    this->batch_started_ = millis();
+  }
   // Do not set last_traffic_ on send
   return true;
 }
@@ -170,6 +170,10 @@ class APIConnection : public APIServerConnection {
   void update_command(const UpdateCommandRequest &msg) override;
 #endif
 
+#ifdef USE_COMPONENT_RUNTIME_STATS
+  ComponentRuntimeStatsResponse component_runtime_stats(const ComponentRuntimeStatsRequest &msg) override;
+#endif
+
   void on_disconnect_response(const DisconnectResponse &value) override;
   void on_ping_response(const PingResponse &value) override {
     // we initiated ping
@@ -188,7 +192,9 @@ class APIConnection : public APIServerConnection {
   void list_entities(const ListEntitiesRequest &msg) override { this->list_entities_iterator_.begin(); }
   void subscribe_states(const SubscribeStatesRequest &msg) override {
     this->state_subscription_ = true;
-    this->initial_state_iterator_.begin();
+    // Only resume from the client's version token if it was issued by this boot of the device
+    uint32_t since_version = msg.state_epoch == EntityBase::get_state_epoch() ? msg.state_version : 0;
+    this->initial_state_iterator_.begin_states(since_version, msg.resumable);
   }
   void subscribe_logs(const SubscribeLogsRequest &msg) override {
     this->log_subscription_ = msg.level;
@@ -215,6 +221,9 @@ class APIConnection : public APIServerConnection {
   ProtoWriteBuffer create_buffer() override {
     // FIXME: ensure no recursive writes can happen
     this->proto_write_buffer_.clear();
+    // Leave room for the frame header so the helper can frame the message in place. The noise helper appends the
+    // MAC behind the message, which only reallocates while the capacity of the reused buffer is still growing.
+    this->proto_write_buffer_.resize(this->helper_->frame_header_padding());
     return {&this->proto_write_buffer_};
   }
   bool send_buffer(ProtoWriteBuffer buffer, uint32_t message_type) override;
@@ -234,7 +243,7 @@ class APIConnection : public APIServerConnection {
 
   bool remove_{false};
 
-  // Buffer used to encode proto messages
+  // Buffer used to encode proto messages, starts with room for the frame header
   // Re-use to prevent allocations
   std::vector<uint8_t> proto_write_buffer_;
   std::unique_ptr<APIFrameHelper> helper_;
@@ -254,6 +263,9 @@ class APIConnection : public APIServerConnection {
   uint32_t next_ping_retry_{0};
   uint8_t ping_retries_{0};
   bool sent_ping_{false};
+  // Whether frames are queued for a coalesced write, and since when
+  bool batch_pending_{false};
+  uint32_t batch_started_{0};
   bool service_call_subscription_{false};
   bool next_close_ = false;
   APIServer *parent_;
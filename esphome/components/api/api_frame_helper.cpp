@@ -12,6 +12,9 @@ namespace api {
 
 static const char *const TAG = "api.socket";
 
+/// When coalescing writes, write queued frames out once this many bytes are queued (about one TCP segment).
+static const size_t COALESCE_FLUSH_SIZE = 1400;
+
 /// Is the given return value (from write syscalls) a wouldblock error?
 bool is_would_block(ssize_t ret) {
   if (ret == -1) {
@@ -152,7 +155,8 @@ APIError APINoiseFrameHelper::loop() {
     return APIError::OK;
   if (err != APIError::OK)
     return err;
-  if (!tx_buf_.empty()) {
+  // queued frames are written by flush() when coalescing, but what it couldn't write goes out as soon as possible
+  if (!tx_buf_.empty() && (!coalesce_writes_ || draining_)) {
     err = try_send_tx_buf_();
     if (err != APIError::OK) {
       return err;
@@ -466,8 +470,15 @@ APIError APINoiseFrameHelper::read_packet(ReadPacketBuffer *buffer) {
   buffer->type = type;
   return APIError::OK;
 }
-bool APINoiseFrameHelper::can_write_without_blocking() { return state_ == State::DATA && tx_buf_.empty(); }
-APIError APINoiseFrameHelper::write_packet(uint16_t type, const uint8_t *payload, size_t payload_len) {
+bool APINoiseFrameHelper::can_write_without_blocking() {
+  return state_ == State::DATA && (tx_buf_.empty() || (coalesce_writes_ && tx_buf_.size() < COALESCE_FLUSH_SIZE));
+}
+APIError APINoiseFrameHelper::flush() {
+  if (tx_buf_.empty())
+    return APIError::OK;
+  return try_send_tx_buf_();
+}
+APIError APINoiseFrameHelper::write_protobuf_packet(uint16_t type, ProtoWriteBuffer buffer) {
   int err;
   APIError aerr;
   aerr = state_action_();
@@ -479,31 +490,33 @@ APIError APINoiseFrameHelper::write_packet(uint16_t type, const uint8_t *payload
     return APIError::WOULD_BLOCK;
   }
 
-  size_t padding = 0;
-  size_t msg_len = 4 + payload_len + padding;
-  size_t frame_len = 3 + msg_len + noise_cipherstate_get_mac_length(send_cipher_);
-  auto tmpbuf = std::unique_ptr<uint8_t[]>{new (std::nothrow) uint8_t[frame_len]};
-  if (tmpbuf == nullptr) {
-    HELPER_LOG("Could not allocate for writing packet");
-    return APIError::OUT_OF_MEMORY;
+  std::vector<uint8_t> *raw_buffer = buffer.get_buffer();
+  const uint8_t header_padding = this->frame_header_padding();
+  if (raw_buffer->size() < header_padding)
+    return APIError::BAD_ARG;
+  const size_t payload_len = raw_buffer->size() - header_padding;
+  const size_t msg_len = 4 + payload_len;
+  const size_t mac_len = noise_cipherstate_get_mac_length(send_cipher_);
+  // The encrypted size is sent as 16 bit value
+  if (msg_len + mac_len > 0xFFFF) {
+    HELPER_LOG("Packet too large to frame: %zu bytes", payload_len);
+    return APIError::BAD_ARG;
   }
+  // Room for the MAC behind the message, the buffer is reused so its capacity usually covers it already
+  raw_buffer->resize(raw_buffer->size() + mac_len);
+  uint8_t *buf = raw_buffer->data();
 
-  tmpbuf[0] = 0x01;  // indicator
-  // tmpbuf[1], tmpbuf[2] to be set later
+  buf[0] = 0x01;  // indicator
+  // buf[1], buf[2] to be set later
   const uint8_t msg_offset = 3;
-  const uint8_t payload_offset = msg_offset + 4;
-  tmpbuf[msg_offset + 0] = (uint8_t) (type >> 8);  // type
-  tmpbuf[msg_offset + 1] = (uint8_t) type;
-  tmpbuf[msg_offset + 2] = (uint8_t) (payload_len >> 8);  // data_len
-  tmpbuf[msg_offset + 3] = (uint8_t) payload_len;
-  // copy data
-  std::copy(payload, payload + payload_len, &tmpbuf[payload_offset]);
-  // fill padding with zeros
-  std::fill(&tmpbuf[payload_offset + payload_len], &tmpbuf[frame_len], 0);
+  buf[msg_offset + 0] = (uint8_t) (type >> 8);  // type
+  buf[msg_offset + 1] = (uint8_t) type;
+  buf[msg_offset + 2] = (uint8_t) (payload_len >> 8);  // data_len
+  buf[msg_offset + 3] = (uint8_t) payload_len;
 
   NoiseBuffer mbuf;
   noise_buffer_init(mbuf);
-  noise_buffer_set_inout(mbuf, &tmpbuf[msg_offset], msg_len, frame_len - msg_offset);
+  noise_buffer_set_inout(mbuf, buf + msg_offset, msg_len, msg_len + mac_len);
   err = noise_cipherstate_encrypt(send_cipher_, &mbuf);
   if (err != 0) {
     state_ = State::FAILED;
@@ -512,11 +525,19 @@ APIError APINoiseFrameHelper::write_packet(uint16_t type, const uint8_t *payload
   }
 
   size_t total_len = 3 + mbuf.size;
-  tmpbuf[1] = (uint8_t) (mbuf.size >> 8);
-  tmpbuf[2] = (uint8_t) mbuf.size;
+  buf[1] = (uint8_t) (mbuf.size >> 8);
+  buf[2] = (uint8_t) mbuf.size;
+
+  if (coalesce_writes_) {
+    // queue the frame, flush() writes it together with the rest of the batch
+    tx_buf_.insert(tx_buf_.end(), buf, buf + total_len);
+    if (tx_buf_.size() < COALESCE_FLUSH_SIZE)
+      return APIError::OK;
+    return try_send_tx_buf_();
+  }
 
   struct iovec iov;
-  iov.iov_base = &tmpbuf[0];
+  iov.iov_base = buf;
   iov.iov_len = total_len;
 
   // write raw to not have two packets sent if NAGLE disabled
@@ -539,6 +560,7 @@ APIError APINoiseFrameHelper::try_send_tx_buf_() {
     // replace with deque of buffers
     tx_buf_.erase(tx_buf_.begin(), tx_buf_.begin() + sent);
   }
+  draining_ = !tx_buf_.empty();
 
   return APIError::OK;
 }
@@ -772,8 +794,9 @@ APIError APIPlaintextFrameHelper::loop() {
   if (state_ != State::DATA) {
     return APIError::BAD_STATE;
   }
-  // try send pending TX data
-  if (!tx_buf_.empty()) {
+  // try send pending TX data, queued frames are written by flush() when coalescing, but what it couldn't write goes
+  // out as soon as possible
+  if (!tx_buf_.empty() && (!coalesce_writes_ || draining_)) {
     APIError err = try_send_tx_buf_();
     if (err != APIError::OK) {
       return err;
@@ -902,27 +925,54 @@ APIError APIPlaintextFrameHelper::read_packet(ReadPacketBuffer *buffer) {
   buffer->type = rx_header_parsed_type_;
   return APIError::OK;
 }
-bool APIPlaintextFrameHelper::can_write_without_blocking() { return state_ == State::DATA && tx_buf_.empty(); }
-APIError APIPlaintextFrameHelper::write_packet(uint16_t type, const uint8_t *payload, size_t payload_len) {
+bool APIPlaintextFrameHelper::can_write_without_blocking() {
+  return state_ == State::DATA && (tx_buf_.empty() || (coalesce_writes_ && tx_buf_.size() < COALESCE_FLUSH_SIZE));
+}
+APIError APIPlaintextFrameHelper::flush() {
+  if (tx_buf_.empty())
+    return APIError::OK;
+  return try_send_tx_buf_();
+}
+APIError APIPlaintextFrameHelper::write_protobuf_packet(uint16_t type, ProtoWriteBuffer buffer) {
   if (state_ != State::DATA) {
     return APIError::BAD_STATE;
   }
 
-  std::vector<uint8_t> header;
-  header.push_back(0x00);
-  ProtoVarInt(payload_len).encode(header);
-  ProtoVarInt(type).encode(header);
+  std::vector<uint8_t> *raw_buffer = buffer.get_buffer();
+  const uint8_t header_padding = this->frame_header_padding();
+  if (raw_buffer->size() < header_padding)
+    return APIError::BAD_ARG;
+  const size_t payload_len = raw_buffer->size() - header_padding;
+
+  ProtoVarInt len_varint(payload_len);
+  ProtoVarInt type_varint(type);
+  const uint8_t header_len = 1 + len_varint.encoded_size() + type_varint.encoded_size();
+  // The padding fits a length varint of up to 3 bytes, i.e. messages below 2 MiB
+  if (header_len > header_padding) {
+    HELPER_LOG("Packet too large to frame: %zu bytes", payload_len);
+    return APIError::BAD_ARG;
+  }
 
-  struct iovec iov[2];
-  iov[0].iov_base = &header[0];
-  iov[0].iov_len = header.size();
-  if (payload_len == 0) {
-    return write_raw_(iov, 1);
+  // Write the header right in front of the message, unused padding stays in front of it
+  uint8_t *header = raw_buffer->data() + (header_padding - header_len);
+  header[0] = 0x00;  // indicator
+  uint8_t pos = 1;
+  pos += len_varint.encode_to(header + pos);
+  type_varint.encode_to(header + pos);
+
+  if (coalesce_writes_) {
+    // queue the frame, flush() writes it together with the rest of the batch
+    tx_buf_.insert(tx_buf_.end(), header, header + header_len + payload_len);
+    if (tx_buf_.size() < COALESCE_FLUSH_SIZE)
+      return APIError::OK;
+    return try_send_tx_buf_();
   }
-  iov[1].iov_base = const_cast<uint8_t *>(payload);
-  iov[1].iov_len = payload_len;
 
-  return write_raw_(iov, 2);
+  struct iovec iov;
+  iov.iov_base = header;
+  iov.iov_len = header_len + payload_len;
+
+  return write_raw_(&iov, 1);
 }
 APIError APIPlaintextFrameHelper::try_send_tx_buf_() {
   // try send from tx_buf
@@ -939,6 +989,7 @@ APIError APIPlaintextFrameHelper::try_send_tx_buf_() {
     // replace with deque of buffers
     tx_buf_.erase(tx_buf_.begin(), tx_buf_.begin() + sent);
   }
+  draining_ = !tx_buf_.empty();
 
   return APIError::OK;
 }
@@ -12,6 +12,7 @@
 
 #include "api_noise_context.h"
 #include "esphome/components/socket/socket.h"
+#include "proto.h"
 
 namespace esphome {
 namespace api {
@@ -65,8 +66,28 @@ class APIFrameHelper {
   virtual APIError loop() = 0;
   virtual APIError read_packet(ReadPacketBuffer *buffer) = 0;
   virtual bool can_write_without_blocking() = 0;
-  virtual APIError write_packet(uint16_t type, const uint8_t *data, size_t len) = 0;
+  /** Frame and send a message that was encoded in place.
+   *
+   * The buffer must start with frame_header_padding() bytes of room, followed by the encoded message. The frame header
+   * is written into that room and the frame is encrypted in place, so the message isn't copied before it is handed to
+   * the socket (unless the socket would block).
+   */
+  virtual APIError write_protobuf_packet(uint16_t type, ProtoWriteBuffer buffer) = 0;
+  /// Number of bytes a buffer passed to write_protobuf_packet() must reserve in front of the message.
+  virtual uint8_t frame_header_padding() = 0;
+  /** Queue messages from write_protobuf_packet() instead of writing each one to the socket right away.
+   *
+   * Queued frames are written by flush(), or as soon as about one TCP segment worth of data is queued. Every message
+   * still gets its own regular frame, so this works with all clients.
+   */
+  virtual void set_coalesce_writes(bool coalesce) = 0;
+  /// Write out queued frames, as far as the socket accepts them.
+  virtual APIError flush() = 0;
+  /// Whether there is framed data that was not written to the socket yet.
+  virtual bool has_pending_writes() = 0;
   virtual std::string getpeername() = 0;
+  /// Whether the underlying socket may have data to read, see socket::Socket::ready().
+  virtual bool is_socket_ready() const = 0;
   virtual int getpeername(struct sockaddr *addr, socklen_t *addrlen) = 0;
   virtual APIError close() = 0;
   virtual APIError shutdown(int how) = 0;
@@ -84,8 +105,14 @@ class APINoiseFrameHelper : public APIFrameHelper {
   APIError loop() override;
   APIError read_packet(ReadPacketBuffer *buffer) override;
   bool can_write_without_blocking() override;
-  APIError write_packet(uint16_t type, const uint8_t *payload, size_t len) override;
+  APIError write_protobuf_packet(uint16_t type, ProtoWriteBuffer buffer) override;
+  // indicator + frame size + message type + data length
+  uint8_t frame_header_padding() override { return 7; }
+  void set_coalesce_writes(bool coalesce) override { this->coalesce_writes_ = coalesce; }
+  APIError flush() override;
+  bool has_pending_writes() override { return !this->tx_buf_.empty(); }
   std::string getpeername() override { return this->socket_->getpeername(); }
+  bool is_socket_ready() const override { return this->socket_ != nullptr && this->socket_->ready(); }
   int getpeername(struct sockaddr *addr, socklen_t *addrlen) override {
     return this->socket_->getpeername(addr, addrlen);
   }
@@ -117,6 +144,9 @@ class APINoiseFrameHelper : public APIFrameHelper {
   size_t rx_buf_len_ = 0;
 
   std::vector<uint8_t> tx_buf_;
+  bool coalesce_writes_{false};
+  // Set while tx_buf_ holds data the socket didn't accept on the last attempt, loop() keeps writing it
+  bool draining_{false};
   std::vector<uint8_t> prologue_;
 
   std::shared_ptr<APINoiseContext> ctx_;
@@ -147,8 +177,14 @@ class APIPlaintextFrameHelper : public APIFrameHelper {
   APIError loop() override;
   APIError read_packet(ReadPacketBuffer *buffer) override;
   bool can_write_without_blocking() override;
-  APIError write_packet(uint16_t type, const uint8_t *payload, size_t len) override;
+  APIError write_protobuf_packet(uint16_t type, ProtoWriteBuffer buffer) override;
+  // indicator + data length varint (up to 3 bytes) + message type varint (up to 2 bytes)
+  uint8_t frame_header_padding() override { return 6; }
+  void set_coalesce_writes(bool coalesce) override { this->coalesce_writes_ = coalesce; }
+  APIError flush() override;
+  bool has_pending_writes() override { return !this->tx_buf_.empty(); }
   std::string getpeername() override { return this->socket_->getpeername(); }
+  bool is_socket_ready() const override { return this->socket_ != nullptr && this->socket_->ready(); }
   int getpeername(struct sockaddr *addr, socklen_t *addrlen) override {
     return this->socket_->getpeername(addr, addrlen);
   }
@@ -178,6 +214,9 @@ class APIPlaintextFrameHelper : public APIFrameHelper {
   size_t rx_buf_len_ = 0;
 
   std::vector<uint8_t> tx_buf_;
+  bool coalesce_writes_{false};
+  // Set while tx_buf_ holds data the socket didn't accept on the last attempt, loop() keeps writing it
+  bool draining_{false};
 
   enum class State {
     INITIALIZE = 1,
@@ -598,7 +598,7 @@ bool HelloRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
 bool HelloRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
   switch (field_id) {
     case 1: {
-      this->client_info = value.as_string();
+      this->client_info = value.as_string_ref();
       return true;
     }
     default:
@@ -691,7 +691,7 @@ void HelloResponse::dump_to(std::string &out) const {
 bool ConnectRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
   switch (field_id) {
     case 1: {
-      this->password = value.as_string();
+      this->password = value.as_string_ref();
       return true;
     }
     default:
@@ -936,9 +936,94 @@ void ListEntitiesDoneResponse::encode(ProtoWriteBuffer buffer) const {}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesDoneResponse::dump_to(std::string &out) const { out.append("ListEntitiesDoneResponse {}"); }
 #endif
-void SubscribeStatesRequest::encode(ProtoWriteBuffer buffer) const {}
+bool SubscribeStatesRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
+  switch (field_id) {
+    case 2: {
+      this->state_version = value.as_uint32();
+      return true;
+    }
+    case 3: {
+      this->resumable = value.as_bool();
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+bool SubscribeStatesRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
+  switch (field_id) {
+    case 1: {
+      this->state_epoch = value.as_fixed32();
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+void SubscribeStatesRequest::encode(ProtoWriteBuffer buffer) const {
+  buffer.encode_fixed32(1, this->state_epoch);
+  buffer.encode_uint32(2, this->state_version);
+  buffer.encode_bool(3, this->resumable);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
-void SubscribeStatesRequest::dump_to(std::string &out) const { out.append("SubscribeStatesRequest {}"); }
+void SubscribeStatesRequest::dump_to(std::string &out) const {
+  __attribute__((unused)) char buffer[64];
+  out.append("SubscribeStatesRequest {\n");
+  out.append("  state_epoch: ");
+  sprintf(buffer, "%" PRIu32, this->state_epoch);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  state_version: ");
+  sprintf(buffer, "%" PRIu32, this->state_version);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  resumable: ");
+  out.append(YESNO(this->resumable));
+  out.append("\n");
+  out.append("}");
+}
+#endif
+bool SubscribeStatesDoneResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
+  switch (field_id) {
+    case 2: {
+      this->state_version = value.as_uint32();
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+bool SubscribeStatesDoneResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
+  switch (field_id) {
+    case 1: {
+      this->state_epoch = value.as_fixed32();
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+void SubscribeStatesDoneResponse::encode(ProtoWriteBuffer buffer) const {
+  buffer.encode_fixed32(1, this->state_epoch);
+  buffer.encode_uint32(2, this->state_version);
+}
+#ifdef HAS_PROTO_MESSAGE_DUMP
+void SubscribeStatesDoneResponse::dump_to(std::string &out) const {
+  __attribute__((unused)) char buffer[64];
+  out.append("SubscribeStatesDoneResponse {\n");
+  out.append("  state_epoch: ");
+  sprintf(buffer, "%" PRIu32, this->state_epoch);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  state_version: ");
+  sprintf(buffer, "%" PRIu32, this->state_version);
+  out.append(buffer);
+  out.append("\n");
+  out.append("}");
+}
 #endif
 bool ListEntitiesBinarySensorResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
@@ -1678,7 +1763,7 @@ bool FanCommandRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
 bool FanCommandRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
   switch (field_id) {
     case 13: {
-      this->preset_mode = value.as_string();
+      this->preset_mode = value.as_string_ref();
       return true;
     }
     default:
@@ -2168,7 +2253,7 @@ bool LightCommandRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
 bool LightCommandRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
   switch (field_id) {
     case 19: {
-      this->effect = value.as_string();
+      this->effect = value.as_string_ref();
       return true;
     }
     default:
@@ -3159,15 +3244,15 @@ void SubscribeHomeAssistantStateResponse::dump_to(std::string &out) const {
 bool HomeAssistantStateResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
   switch (field_id) {
     case 1: {
-      this->entity_id = value.as_string();
+      this->entity_id = value.as_string_ref();
       return true;
     }
     case 2: {
-      this->state = value.as_string();
+      this->state = value.as_string_ref();
       return true;
     }
     case 3: {
-      this->attribute = value.as_string();
+      this->attribute = value.as_string_ref();
       return true;
     }
     default:
@@ -4183,11 +4268,11 @@ bool ClimateCommandRequest::decode_varint(uint32_t field_id, ProtoVarInt value)
 bool ClimateCommandRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
   switch (field_id) {
     case 17: {
-      this->custom_fan_mode = value.as_string();
+      this->custom_fan_mode = value.as_string_ref();
       return true;
     }
     case 21: {
-      this->custom_preset = value.as_string();
+      this->custom_preset = value.as_string_ref();
       return true;
     }
     default:
@@ -4738,7 +4823,7 @@ void SelectStateResponse::dump_to(std::string &out) const {
 bool SelectCommandRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
   switch (field_id) {
     case 2: {
-      this->state = value.as_string();
+      this->state = value.as_string_ref();
       return true;
     }
     default:
@@ -4956,7 +5041,7 @@ bool LockCommandRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
 bool LockCommandRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
   switch (field_id) {
     case 4: {
-      this->code = value.as_string();
+      this->code = value.as_string_ref();
       return true;
     }
     default:
@@ -5313,7 +5398,7 @@ bool MediaPlayerCommandRequest::decode_varint(uint32_t field_id, ProtoVarInt val
 bool MediaPlayerCommandRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
   switch (field_id) {
     case 7: {
-      this->media_url = value.as_string();
+      this->media_url = value.as_string_ref();
       return true;
     }
     default:
@@ -6109,7 +6194,7 @@ bool BluetoothGATTWriteRequest::decode_varint(uint32_t field_id, ProtoVarInt val
 bool BluetoothGATTWriteRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
   switch (field_id) {
     case 4: {
-      this->data = value.as_string();
+      this->data = value.as_string_ref();
       return true;
     }
     default:
@@ -6197,7 +6282,7 @@ bool BluetoothGATTWriteDescriptorRequest::decode_varint(uint32_t field_id, Proto
 bool BluetoothGATTWriteDescriptorRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
   switch (field_id) {
     case 3: {
-      this->data = value.as_string();
+      this->data = value.as_string_ref();
       return true;
     }
     default:
@@ -6927,11 +7012,11 @@ bool VoiceAssistantTimerEventResponse::decode_varint(uint32_t field_id, ProtoVar
 bool VoiceAssistantTimerEventResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
   switch (field_id) {
     case 2: {
-      this->timer_id = value.as_string();
+      this->timer_id = value.as_string_ref();
       return true;
     }
     case 3: {
-      this->name = value.as_string();
+      this->name = value.as_string_ref();
       return true;
     }
     default:
@@ -7148,7 +7233,7 @@ bool AlarmControlPanelCommandRequest::decode_varint(uint32_t field_id, ProtoVarI
 bool AlarmControlPanelCommandRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
   switch (field_id) {
     case 3: {
-      this->code = value.as_string();
+      this->code = value.as_string_ref();
       return true;
     }
     default:
@@ -7374,7 +7459,7 @@ void TextStateResponse::dump_to(std::string &out) const {
 bool TextCommandRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
   switch (field_id) {
     case 2: {
-      this->state = value.as_string();
+      this->state = value.as_string_ref();
       return true;
     }
     default:
@@ -8661,6 +8746,181 @@ void UpdateCommandRequest::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+bool ComponentRuntimeStatsRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
+  switch (field_id) {
+    case 1: {
+      this->reset = value.as_bool();
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+void ComponentRuntimeStatsRequest::encode(ProtoWriteBuffer buffer) const { buffer.encode_bool(1, this->reset); }
+#ifdef HAS_PROTO_MESSAGE_DUMP
+void ComponentRuntimeStatsRequest::dump_to(std::string &out) const {
+  __attribute__((unused)) char buffer[64];
+  out.append("ComponentRuntimeStatsRequest {\n");
+  out.append("  reset: ");
+  out.append(YESNO(this->reset));
+  out.append("\n");
+  out.append("}");
+}
+#endif
+bool ComponentRuntimeStatsEntry::decode_varint(uint32_t field_id, ProtoVarInt value) {
+  switch (field_id) {
+    case 2: {
+      this->setup_us = value.as_uint32();
+      return true;
+    }
+    case 3: {
+      this->loop_count = value.as_uint32();
+      return true;
+    }
+    case 4: {
+      this->loop_total_us = value.as_uint64();
+      return true;
+    }
+    case 5: {
+      this->loop_max_us = value.as_uint32();
+      return true;
+    }
+    case 6: {
+      this->loop_buckets.push_back(value.as_uint32());
+      return true;
+    }
+    case 7: {
+      this->scheduler_count = value.as_uint32();
+      return true;
+    }
+    case 8: {
+      this->scheduler_total_us = value.as_uint64();
+      return true;
+    }
+    case 9: {
+      this->scheduler_max_us = value.as_uint32();
+      return true;
+    }
+    case 10: {
+      this->scheduler_buckets.push_back(value.as_uint32());
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+bool ComponentRuntimeStatsEntry::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
+  switch (field_id) {
+    case 1: {
+      this->component = value.as_string();
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+void ComponentRuntimeStatsEntry::encode(ProtoWriteBuffer buffer) const {
+  buffer.encode_string(1, this->component);
+  buffer.encode_uint32(2, this->setup_us);
+  buffer.encode_uint32(3, this->loop_count);
+  buffer.encode_uint64(4, this->loop_total_us);
+  buffer.encode_uint32(5, this->loop_max_us);
+  for (auto &it : this->loop_buckets) {
+    buffer.encode_uint32(6, it, true);
+  }
+  buffer.encode_uint32(7, this->scheduler_count);
+  buffer.encode_uint64(8, this->scheduler_total_us);
+  buffer.encode_uint32(9, this->scheduler_max_us);
+  for (auto &it : this->scheduler_buckets) {
+    buffer.encode_uint32(10, it, true);
+  }
+}
+#ifdef HAS_PROTO_MESSAGE_DUMP
+void ComponentRuntimeStatsEntry::dump_to(std::string &out) const {
+  __attribute__((unused)) char buffer[64];
+  out.append("ComponentRuntimeStatsEntry {\n");
+  out.append("  component: ");
+  out.append("'").append(this->component).append("'");
+  out.append("\n");
+
+  out.append("  setup_us: ");
+  sprintf(buffer, "%" PRIu32, this->setup_us);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  loop_count: ");
+  sprintf(buffer, "%" PRIu32, this->loop_count);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  loop_total_us: ");
+  sprintf(buffer, "%llu", this->loop_total_us);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  loop_max_us: ");
+  sprintf(buffer, "%" PRIu32, this->loop_max_us);
+  out.append(buffer);
+  out.append("\n");
+
+  for (const auto &it : this->loop_buckets) {
+    out.append("  loop_buckets: ");
+    sprintf(buffer, "%" PRIu32, it);
+    out.append(buffer);
+    out.append("\n");
+  }
+
+  out.append("  scheduler_count: ");
+  sprintf(buffer, "%" PRIu32, this->scheduler_count);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  scheduler_total_us: ");
+  sprintf(buffer, "%llu", this->scheduler_total_us);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  scheduler_max_us: ");
+  sprintf(buffer, "%" PRIu32, this->scheduler_max_us);
+  out.append(buffer);
+  out.append("\n");
+
+  for (const auto &it : this->scheduler_buckets) {
+    out.append("  scheduler_buckets: ");
+    sprintf(buffer, "%" PRIu32, it);
+    out.append(buffer);
+    out.append("\n");
+  }
+  out.append("}");
+}
+#endif
+bool ComponentRuntimeStatsResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
+  switch (field_id) {
+    case 1: {
+      this->components.push_back(value.as_message<ComponentRuntimeStatsEntry>());
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+void ComponentRuntimeStatsResponse::encode(ProtoWriteBuffer buffer) const {
+  for (auto &it : this->components) {
+    buffer.encode_message<ComponentRuntimeStatsEntry>(1, it, true);
+  }
+}
+#ifdef HAS_PROTO_MESSAGE_DUMP
+void ComponentRuntimeStatsResponse::dump_to(std::string &out) const {
+  __attribute__((unused)) char buffer[64];
+  out.append("ComponentRuntimeStatsResponse {\n");
+  for (const auto &it : this->components) {
+    out.append("  components: ");
+    it.dump_to(out);
+    out.append("\n");
+  }
+  out.append("}");
+}
+#endif
 
 }  // namespace api
 }  // namespace esphome
@@ -237,7 +237,7 @@ enum UpdateCommand : uint32_t {
 
 class HelloRequest : public ProtoMessage {
  public:
-  std::string client_info{};
+  StringRef client_info{};
   uint32_t api_version_major{0};
   uint32_t api_version_minor{0};
   void encode(ProtoWriteBuffer buffer) const override;
@@ -266,7 +266,7 @@ class HelloResponse : public ProtoMessage {
 };
 class ConnectRequest : public ProtoMessage {
  public:
-  std::string password{};
+  StringRef password{};
   void encode(ProtoWriteBuffer buffer) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
@@ -379,12 +379,30 @@ class ListEntitiesDoneResponse : public ProtoMessage {
 };
 class SubscribeStatesRequest : public ProtoMessage {
  public:
+  uint32_t state_epoch{0};
+  uint32_t state_version{0};
+  bool resumable{false};
   void encode(ProtoWriteBuffer buffer) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
+  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+};
+class SubscribeStatesDoneResponse : public ProtoMessage {
+ public:
+  uint32_t state_epoch{0};
+  uint32_t state_version{0};
+  void encode(ProtoWriteBuffer buffer) const override;
+#ifdef HAS_PROTO_MESSAGE_DUMP
+  void dump_to(std::string &out) const override;
+#endif
+
+ protected:
+  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
+  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
 class ListEntitiesBinarySensorResponse : public ProtoMessage {
  public:
@@ -537,7 +555,7 @@ class FanCommandRequest : public ProtoMessage {
   bool has_speed_level{false};
   int32_t speed_level{0};
   bool has_preset_mode{false};
-  std::string preset_mode{};
+  StringRef preset_mode{};
   void encode(ProtoWriteBuffer buffer) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
@@ -628,7 +646,7 @@ class LightCommandRequest : public ProtoMessage {
   bool has_flash_length{false};
   uint32_t flash_length{0};
   bool has_effect{false};
-  std::string effect{};
+  StringRef effect{};
   void encode(ProtoWriteBuffer buffer) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
@@ -848,9 +866,9 @@ class SubscribeHomeAssistantStateResponse : public ProtoMessage {
 };
 class HomeAssistantStateResponse : public ProtoMessage {
  public:
-  std::string entity_id{};
-  std::string state{};
-  std::string attribute{};
+  StringRef entity_id{};
+  StringRef state{};
+  StringRef attribute{};
   void encode(ProtoWriteBuffer buffer) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
@@ -1068,11 +1086,11 @@ class ClimateCommandRequest : public ProtoMessage {
   bool has_swing_mode{false};
   enums::ClimateSwingMode swing_mode{};
   bool has_custom_fan_mode{false};
-  std::string custom_fan_mode{};
+  StringRef custom_fan_mode{};
   bool has_preset{false};
   enums::ClimatePreset preset{};
   bool has_custom_preset{false};
-  std::string custom_preset{};
+  StringRef custom_preset{};
   bool has_target_humidity{false};
   float target_humidity{0.0f};
   void encode(ProtoWriteBuffer buffer) const override;
@@ -1174,7 +1192,7 @@ class SelectStateResponse : public ProtoMessage {
 class SelectCommandRequest : public ProtoMessage {
  public:
   uint32_t key{0};
-  std::string state{};
+  StringRef state{};
   void encode(ProtoWriteBuffer buffer) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
@@ -1225,7 +1243,7 @@ class LockCommandRequest : public ProtoMessage {
   uint32_t key{0};
   enums::LockCommand command{};
   bool has_code{false};
-  std::string code{};
+  StringRef code{};
   void encode(ProtoWriteBuffer buffer) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
@@ -1310,7 +1328,7 @@ class MediaPlayerCommandRequest : public ProtoMessage {
   bool has_volume{false};
   float volume{0.0f};
   bool has_media_url{false};
-  std::string media_url{};
+  StringRef media_url{};
   bool has_announcement{false};
   bool announcement{false};
   void encode(ProtoWriteBuffer buffer) const override;
@@ -1527,7 +1545,7 @@ class BluetoothGATTWriteRequest : public ProtoMessage {
   uint64_t address{0};
   uint32_t handle{0};
   bool response{false};
-  std::string data{};
+  StringRef data{};
   void encode(ProtoWriteBuffer buffer) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
@@ -1553,7 +1571,7 @@ class BluetoothGATTWriteDescriptorRequest : public ProtoMessage {
  public:
   uint64_t address{0};
   uint32_t handle{0};
-  std::string data{};
+  StringRef data{};
   void encode(ProtoWriteBuffer buffer) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
@@ -1791,8 +1809,8 @@ class VoiceAssistantAudio : public ProtoMessage {
 class VoiceAssistantTimerEventResponse : public ProtoMessage {
  public:
   enums::VoiceAssistantTimerEvent event_type{};
-  std::string timer_id{};
-  std::string name{};
+  StringRef timer_id{};
+  StringRef name{};
   uint32_t total_seconds{0};
   uint32_t seconds_left{0};
   bool is_active{false};
@@ -1844,7 +1862,7 @@ class AlarmControlPanelCommandRequest : public ProtoMessage {
  public:
   uint32_t key{0};
   enums::AlarmControlPanelStateCommand command{};
-  std::string code{};
+  StringRef code{};
   void encode(ProtoWriteBuffer buffer) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
@@ -1896,7 +1914,7 @@ class TextStateResponse : public ProtoMessage {
 class TextCommandRequest : public ProtoMessage {
  public:
   uint32_t key{0};
-  std::string state{};
+  StringRef state{};
   void encode(ProtoWriteBuffer buffer) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
@@ -2192,6 +2210,49 @@ class UpdateCommandRequest : public ProtoMessage {
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
+class ComponentRuntimeStatsRequest : public ProtoMessage {
+ public:
+  bool reset{false};
+  void encode(ProtoWriteBuffer buffer) const override;
+#ifdef HAS_PROTO_MESSAGE_DUMP
+  void dump_to(std::string &out) const override;
+#endif
+
+ protected:
+  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+};
+class ComponentRuntimeStatsEntry : public ProtoMessage {
+ public:
+  std::string component{};
+  uint32_t setup_us{0};
+  uint32_t loop_count{0};
+  uint64_t loop_total_us{0};
+  uint32_t loop_max_us{0};
+  std::vector<uint32_t> loop_buckets{};
+  uint32_t scheduler_count{0};
+  uint64_t scheduler_total_us{0};
+  uint32_t scheduler_max_us{0};
+  std::vector<uint32_t> scheduler_buckets{};
+  void encode(ProtoWriteBuffer buffer) const override;
+#ifdef HAS_PROTO_MESSAGE_DUMP
+  void dump_to(std::string &out) const override;
+#endif
+
+ protected:
+  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
+  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+};
+class ComponentRuntimeStatsResponse : public ProtoMessage {
+ public:
+  std::vector<ComponentRuntimeStatsEntry> components{};
+  void encode(ProtoWriteBuffer buffer) const override;
+#ifdef HAS_PROTO_MESSAGE_DUMP
+  void dump_to(std::string &out) const override;
+#endif
+
+ protected:
+  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
+};
 
 }  // namespace api
 }  // namespace esphome
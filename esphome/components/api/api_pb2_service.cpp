@@ -56,6 +56,12 @@ bool APIServerConnectionBase::send_list_entities_done_response(const ListEntitie
 #endif
   return this->send_message_<ListEntitiesDoneResponse>(msg, 19);
 }
+bool APIServerConnectionBase::send_subscribe_states_done_response(const SubscribeStatesDoneResponse &msg) {
+#ifdef HAS_PROTO_MESSAGE_DUMP
+  ESP_LOGVV(TAG, "send_subscribe_states_done_response: %s", msg.dump().c_str());
+#endif
+  return this->send_message_<SubscribeStatesDoneResponse>(msg, 119);
+}
 #ifdef USE_BINARY_SENSOR
 bool APIServerConnectionBase::send_list_entities_binary_sensor_response(const ListEntitiesBinarySensorResponse &msg) {
 #ifdef HAS_PROTO_MESSAGE_DUMP
@@ -629,6 +635,16 @@ bool APIServerConnectionBase::send_update_state_response(const UpdateStateRespon
 #endif
 #ifdef USE_UPDATE
 #endif
+#ifdef USE_COMPONENT_RUNTIME_STATS
+#endif
+#ifdef USE_COMPONENT_RUNTIME_STATS
+bool APIServerConnectionBase::send_component_runtime_stats_response(const ComponentRuntimeStatsResponse &msg) {
+#ifdef HAS_PROTO_MESSAGE_DUMP
+  ESP_LOGVV(TAG, "send_component_runtime_stats_response: %s", msg.dump().c_str());
+#endif
+  return this->send_message_<ComponentRuntimeStatsResponse>(msg, 121);
+}
+#endif
 bool APIServerConnectionBase::read_message(uint32_t msg_size, uint32_t msg_type, uint8_t *msg_data) {
   switch (msg_type) {
     case 1: {
@@ -1135,6 +1151,17 @@ bool APIServerConnectionBase::read_message(uint32_t msg_size, uint32_t msg_type,
       ESP_LOGVV(TAG, "on_update_command_request: %s", msg.dump().c_str());
 #endif
       this->on_update_command_request(msg);
+#endif
+      break;
+    }
+    case 120: {
+#ifdef USE_COMPONENT_RUNTIME_STATS
+      ComponentRuntimeStatsRequest msg;
+      msg.decode(msg_data, msg_size);
+#ifdef HAS_PROTO_MESSAGE_DUMP
+      ESP_LOGVV(TAG, "on_component_runtime_stats_request: %s", msg.dump().c_str());
+#endif
+      this->on_component_runtime_stats_request(msg);
 #endif
       break;
     }
@@ -1638,6 +1665,22 @@ void APIServerConnection::on_alarm_control_panel_command_request(const AlarmCont
   this->alarm_control_panel_command(msg);
 }
 #endif
+#ifdef USE_COMPONENT_RUNTIME_STATS
+void APIServerConnection::on_component_runtime_stats_request(const ComponentRuntimeStatsRequest &msg) {
+  if (!this->is_connection_setup()) {
+    this->on_no_setup_connection();
+    return;
+  }
+  if (!this->is_authenticated()) {
+    this->on_unauthenticated_access();
+    return;
+  }
+  ComponentRuntimeStatsResponse ret = this->component_runtime_stats(msg);
+  if (!this->send_component_runtime_stats_response(ret)) {
+    this->on_fatal_error();
+  }
+}
+#endif
 
 }  // namespace api
 }  // namespace esphome
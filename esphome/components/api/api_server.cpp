@@ -24,7 +24,7 @@ static const char *const TAG = "api";
 void APIServer::setup() {
   ESP_LOGCONFIG(TAG, "Setting up Home Assistant API server...");
   this->setup_controller();
-  socket_ = socket::socket_ip(SOCK_STREAM, 0);
+  socket_ = socket::socket_ip_loop_monitored(SOCK_STREAM, 0);
   if (socket_ == nullptr) {
     ESP_LOGW(TAG, "Could not create socket.");
     this->mark_failed();
@@ -93,7 +93,7 @@ void APIServer::setup() {
 }
 void APIServer::loop() {
   // Accept new clients
-  while (true) {
+  while (this->socket_->ready()) {
     struct sockaddr_storage source_addr;
     socklen_t addr_len = sizeof(source_addr);
     auto sock = socket_->accept((struct sockaddr *) &source_addr, &addr_len);
@@ -143,6 +143,9 @@ void APIServer::dump_config() {
 #else
   ESP_LOGCONFIG(TAG, "  Using noise encryption: NO");
 #endif
+  if (this->batch_delay_ != 0) {
+    ESP_LOGCONFIG(TAG, "  Batch delay: %ums", this->batch_delay_);
+  }
 }
 bool APIServer::uses_password() const { return !this->password_.empty(); }
 bool APIServer::check_password(const std::string &password) const {
@@ -178,6 +181,7 @@ void APIServer::handle_disconnect(APIConnection *conn) {}
 void APIServer::on_binary_sensor_update(binary_sensor::BinarySensor *obj, bool state) {
   if (obj->is_internal())
     return;
+  obj->mark_state_changed();
   for (auto &c : this->clients_)
     c->send_binary_sensor_state(obj, state);
 }
@@ -187,6 +191,7 @@ void APIServer::on_binary_sensor_update(binary_sensor::BinarySensor *obj, bool s
 void APIServer::on_cover_update(cover::Cover *obj) {
   if (obj->is_internal())
     return;
+  obj->mark_state_changed();
   for (auto &c : this->clients_)
     c->send_cover_state(obj);
 }
@@ -196,6 +201,7 @@ void APIServer::on_cover_update(cover::Cover *obj) {
 void APIServer::on_fan_update(fan::Fan *obj) {
   if (obj->is_internal())
     return;
+  obj->mark_state_changed();
   for (auto &c : this->clients_)
     c->send_fan_state(obj);
 }
@@ -205,6 +211,7 @@ void APIServer::on_fan_update(fan::Fan *obj) {
 void APIServer::on_light_update(light::LightState *obj) {
   if (obj->is_internal())
     return;
+  obj->mark_state_changed();
   for (auto &c : this->clients_)
     c->send_light_state(obj);
 }
@@ -214,6 +221,7 @@ void APIServer::on_light_update(light::LightState *obj) {
 void APIServer::on_sensor_update(sensor::Sensor *obj, float state) {
   if (obj->is_internal())
     return;
+  obj->mark_state_changed();
   for (auto &c : this->clients_)
     c->send_sensor_state(obj, state);
 }
@@ -223,6 +231,7 @@ void APIServer::on_sensor_update(sensor::Sensor *obj, float state) {
 void APIServer::on_switch_update(switch_::Switch *obj, bool state) {
   if (obj->is_internal())
     return;
+  obj->mark_state_changed();
   for (auto &c : this->clients_)
     c->send_switch_state(obj, state);
 }
@@ -232,6 +241,7 @@ void APIServer::on_switch_update(switch_::Switch *obj, bool state) {
 void APIServer::on_text_sensor_update(text_sensor::TextSensor *obj, const std::string &state) {
   if (obj->is_internal())
     return;
+  obj->mark_state_changed();
   for (auto &c : this->clients_)
     c->send_text_sensor_state(obj, state);
 }
@@ -241,6 +251,7 @@ void APIServer::on_text_sensor_update(text_sensor::TextSensor *obj, const std::s
 void APIServer::on_climate_update(climate::Climate *obj) {
   if (obj->is_internal())
     return;
+  obj->mark_state_changed();
   for (auto &c : this->clients_)
     c->send_climate_state(obj);
 }
@@ -250,6 +261,7 @@ void APIServer::on_climate_update(climate::Climate *obj) {
 void APIServer::on_number_update(number::Number *obj, float state) {
   if (obj->is_internal())
     return;
+  obj->mark_state_changed();
   for (auto &c : this->clients_)
     c->send_number_state(obj, state);
 }
@@ -259,6 +271,7 @@ void APIServer::on_number_update(number::Number *obj, float state) {
 void APIServer::on_date_update(datetime::DateEntity *obj) {
   if (obj->is_internal())
     return;
+  obj->mark_state_changed();
   for (auto &c : this->clients_)
     c->send_date_state(obj);
 }
@@ -268,6 +281,7 @@ void APIServer::on_date_update(datetime::DateEntity *obj) {
 void APIServer::on_time_update(datetime::TimeEntity *obj) {
   if (obj->is_internal())
     return;
+  obj->mark_state_changed();
   for (auto &c : this->clients_)
     c->send_time_state(obj);
 }
@@ -277,6 +291,7 @@ void APIServer::on_time_update(datetime::TimeEntity *obj) {
 void APIServer::on_datetime_update(datetime::DateTimeEntity *obj) {
   if (obj->is_internal())
     return;
+  obj->mark_state_changed();
   for (auto &c : this->clients_)
     c->send_datetime_state(obj);
 }
@@ -286,6 +301,7 @@ void APIServer::on_datetime_update(datetime::DateTimeEntity *obj) {
 void APIServer::on_text_update(text::Text *obj, const std::string &state) {
   if (obj->is_internal())
     return;
+  obj->mark_state_changed();
   for (auto &c : this->clients_)
     c->send_text_state(obj, state);
 }
@@ -295,6 +311,7 @@ void APIServer::on_text_update(text::Text *obj, const std::string &state) {
 void APIServer::on_select_update(select::Select *obj, const std::string &state, size_t index) {
   if (obj->is_internal())
     return;
+  obj->mark_state_changed();
   for (auto &c : this->clients_)
     c->send_select_state(obj, state);
 }
@@ -304,6 +321,7 @@ void APIServer::on_select_update(select::Select *obj, const std::string &state,
 void APIServer::on_lock_update(lock::Lock *obj) {
   if (obj->is_internal())
     return;
+  obj->mark_state_changed();
   for (auto &c : this->clients_)
     c->send_lock_state(obj, obj->state);
 }
@@ -313,6 +331,7 @@ void APIServer::on_lock_update(lock::Lock *obj) {
 void APIServer::on_valve_update(valve::Valve *obj) {
   if (obj->is_internal())
     return;
+  obj->mark_state_changed();
   for (auto &c : this->clients_)
     c->send_valve_state(obj);
 }
@@ -322,6 +341,7 @@ void APIServer::on_valve_update(valve::Valve *obj) {
 void APIServer::on_media_player_update(media_player::MediaPlayer *obj) {
   if (obj->is_internal())
     return;
+  obj->mark_state_changed();
   for (auto &c : this->clients_)
     c->send_media_player_state(obj);
 }
@@ -336,6 +356,7 @@ void APIServer::on_event(event::Event *obj, const std::string &event_type) {
 
 #ifdef USE_UPDATE
 void APIServer::on_update(update::UpdateEntity *obj) {
+  obj->mark_state_changed();
   for (auto &c : this->clients_)
     c->send_update_state(obj);
 }
@@ -388,6 +409,8 @@ bool APIServer::is_connected() const { return !this->clients_.empty(); }
 void APIServer::on_shutdown() {
   for (auto &c : this->clients_) {
     c->send_disconnect_request(DisconnectRequest());
+    // With batch_delay the request would otherwise wait in the queue until after the reboot
+    c->helper_->flush();
   }
   delay(10);
 }
@@ -396,6 +419,7 @@ void APIServer::on_shutdown() {
 void APIServer::on_alarm_control_panel_update(alarm_control_panel::AlarmControlPanel *obj) {
   if (obj->is_internal())
     return;
+  obj->mark_state_changed();
   for (auto &c : this->clients_)
     c->send_alarm_control_panel_state(obj);
 }
@@ -32,6 +32,9 @@ class APIServer : public Component, public Controller {
   void set_port(uint16_t port);
   void set_password(const std::string &password);
   void set_reboot_timeout(uint32_t reboot_timeout);
+  /// Coalesce messages sent within batch_delay ms into a single socket write, 0 writes every message right away.
+  void set_batch_delay(uint16_t batch_delay) { this->batch_delay_ = batch_delay; }
+  uint16_t get_batch_delay() const { return this->batch_delay_; }
 
 #ifdef USE_API_NOISE
   void set_noise_psk(psk_t psk) { noise_ctx_->set_psk(psk); }
@@ -131,6 +134,7 @@ class APIServer : public Component, public Controller {
   std::unique_ptr<socket::Socket> socket_ = nullptr;
   uint16_t port_{6053};
   uint32_t reboot_timeout_{300000};
+  uint16_t batch_delay_{0};
   uint32_t last_connected_{0};
   std::vector<std::unique_ptr<APIConnection>> clients_;
   std::string password_;
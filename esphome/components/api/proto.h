@@ -3,6 +3,7 @@
 #include "esphome/core/component.h"
 #include "esphome/core/log.h"
 #include "esphome/core/helpers.h"
+#include "esphome/core/string_ref.h"
 
 #include <vector>
 
@@ -71,6 +72,27 @@ class ProtoVarInt {
       return static_cast<int64_t>(this->value_ >> 1);
     }
   }
+  /// Number of bytes this value takes when encoded.
+  uint8_t encoded_size() const {
+    uint64_t val = this->value_;
+    uint8_t size = 1;
+    while (val > 0x7F) {
+      val >>= 7;
+      size++;
+    }
+    return size;
+  }
+  /// Encode into out, which must have room for encoded_size() bytes. Returns the number of bytes written.
+  uint8_t encode_to(uint8_t *out) const {
+    uint64_t val = this->value_;
+    uint8_t i = 0;
+    while (val > 0x7F) {
+      out[i++] = (val & 0x7F) | 0x80;
+      val >>= 7;
+    }
+    out[i++] = val;
+    return i;
+  }
   void encode(std::vector<uint8_t> &out) {
     uint64_t val = this->value_;
     if (val <= 0x7F) {
@@ -96,6 +118,9 @@ class ProtoLengthDelimited {
  public:
   explicit ProtoLengthDelimited(const uint8_t *value, size_t length) : value_(value), length_(length) {}
   std::string as_string() const { return std::string(reinterpret_cast<const char *>(this->value_), this->length_); }
+  /// View into the receive buffer without copying. Only valid until the message handler returns, and not
+  /// null-terminated.
+  StringRef as_string_ref() const { return StringRef(this->value_, this->length_); }
   template<class C> C as_message() const {
     auto msg = C();
     msg.decode(this->value_, this->length_);
@@ -165,6 +190,9 @@ class ProtoWriteBuffer {
   void encode_string(uint32_t field_id, const std::string &value, bool force = false) {
     this->encode_string(field_id, value.data(), value.size());
   }
+  void encode_string(uint32_t field_id, const StringRef &value, bool force = false) {
+    this->encode_string(field_id, value.c_str(), value.size(), force);
+  }
   void encode_bytes(uint32_t field_id, const uint8_t *data, size_t len, bool force = false) {
     this->encode_string(field_id, reinterpret_cast<const char *>(data), len, force);
   }
@@ -261,9 +289,9 @@ class ProtoWriteBuffer {
 
     const uint32_t nested_length = this->buffer_->size() - begin;
     // add size varint
-    std::vector<uint8_t> var;
-    ProtoVarInt(nested_length).encode(var);
-    this->buffer_->insert(this->buffer_->begin() + begin, var.begin(), var.end());
+    uint8_t var[10];
+    uint8_t var_len = ProtoVarInt(nested_length).encode_to(var);
+    this->buffer_->insert(this->buffer_->begin() + begin, var, var + var_len);
   }
   std::vector<uint8_t> *get_buffer() const { return buffer_; }
 
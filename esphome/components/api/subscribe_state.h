@@ -13,6 +13,12 @@ class APIConnection;
 class InitialStateIterator : public ComponentIterator {
  public:
   InitialStateIterator(APIConnection *client);
+  /** Start sending states, skipping entities that have not changed since `since_version`.
+   *
+   * A `since_version` of 0 sends every entity. If `send_done` is set, a SubscribeStatesDoneResponse carrying the
+   * version to resume from is sent once the iteration is complete.
+   */
+  void begin_states(uint32_t since_version, bool send_done);
 #ifdef USE_BINARY_SENSOR
   bool on_binary_sensor(binary_sensor::BinarySensor *binary_sensor) override;
 #endif
@@ -76,8 +82,17 @@ class InitialStateIterator : public ComponentIterator {
 #ifdef USE_UPDATE
   bool on_update(update::UpdateEntity *update) override;
 #endif
+  bool on_end() override;
+
  protected:
+  bool should_send_(EntityBase *entity) const {
+    return this->since_version_ == 0 || entity->get_state_version() > this->since_version_;
+  }
+
   APIConnection *client_;
+  uint32_t since_version_{0};
+  uint32_t begin_version_{0};
+  bool send_done_{false};
 };
 
 }  // namespace api
@@ -1,6 +1,7 @@
 #include "debug_component.h"
 
 #include <algorithm>
+#include "esphome/core/application.h"
 #include "esphome/core/log.h"
 #include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
@@ -85,7 +86,34 @@ void DebugComponent::update() {
 
 #endif  // USE_SENSOR
   update_platform_();
+
+#ifdef USE_COMPONENT_RUNTIME_STATS
+  this->log_component_stats();
+#endif
+}
+
+#ifdef USE_COMPONENT_RUNTIME_STATS
+void DebugComponent::log_component_stats() {
+  std::vector<Component *> components = App.get_components();
+  auto busy_us = [](Component *c) { return c->get_loop_stats().total_us + c->get_scheduler_stats().total_us; };
+  std::sort(components.begin(), components.end(),
+            [&busy_us](Component *a, Component *b) { return busy_us(a) > busy_us(b); });
+
+  ESP_LOGD(TAG, "Component runtime (us):");
+  for (Component *component : components) {
+    const ComponentRuntimeStats &loop = component->get_loop_stats();
+    const ComponentRuntimeStats &sched = component->get_scheduler_stats();
+    if (loop.count == 0 && sched.count == 0)
+      continue;
+    ESP_LOGD(TAG,
+             "  %s: loop n=%" PRIu32 " p50=%" PRIu32 " p99=%" PRIu32 " max=%" PRIu32 ", scheduler n=%" PRIu32
+             " p50=%" PRIu32 " p99=%" PRIu32 " max=%" PRIu32 ", setup=%" PRIu32,
+             component->get_component_source(), loop.count, loop.percentile(50), loop.percentile(99), loop.max_us,
+             sched.count, sched.percentile(50), sched.percentile(99), sched.max_us, component->get_setup_time_us());
+    component->reset_runtime_stats();
+  }
 }
+#endif
 
 float DebugComponent::get_setup_priority() const { return setup_priority::LATE; }
 
@@ -22,6 +22,11 @@ class DebugComponent : public PollingComponent {
   float get_setup_priority() const override;
   void dump_config() override;
 
+#ifdef USE_COMPONENT_RUNTIME_STATS
+  /// Log the loop/scheduler runtime histograms of all components, busiest first, and start a new window.
+  void log_component_stats();
+#endif
+
 #ifdef USE_TEXT_SENSOR
   void set_device_info_sensor(text_sensor::TextSensor *device_info) { device_info_ = device_info; }
   void set_reset_reason_sensor(text_sensor::TextSensor *reset_reason) { reset_reason_ = reset_reason; }
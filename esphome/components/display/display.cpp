@@ -85,11 +85,39 @@ void Display::draw_pixels_at(int x_start, int y_start, int w, int h, const uint8
   }
 }
 
-void HOT Display::horizontal_line(int x, int y, int width, Color color) {
-  // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
+void HOT Display::fill_span(int x, int y, int width, Color color) {
   for (int i = x; i < x + width; i++)
     this->draw_pixel_at(i, y, color);
 }
+void HOT Display::blit_rect(int x, int y, int width, int height, const Color *colors) {
+  for (int row = 0; row < height; row++) {
+    for (int col = 0; col < width; col++, colors++) {
+      if (colors->w >= 0x80)
+        this->draw_pixel_at(x + col, y + row, *colors);
+    }
+  }
+}
+void HOT Display::blit_alpha_mask(int x, int y, int width, int height, const uint8_t *mask, uint8_t bpp,
+                                  Color color, Color background) {
+  const uint8_t max_alpha = (1 << bpp) - 1;
+  uint32_t index = 0;
+  for (int row = 0; row < height; row++) {
+    for (int col = 0; col < width; col++, index++) {
+      uint8_t alpha = alpha_mask_value_(mask, index, bpp);
+      if (alpha == max_alpha) {
+        this->draw_pixel_at(x + col, y + row, color);
+      } else if (alpha != 0) {
+        this->draw_pixel_at(x + col, y + row, ColorUtil::blend(background, color, alpha, max_alpha));
+      }
+    }
+  }
+}
+uint8_t Display::alpha_mask_value_(const uint8_t *mask, uint32_t index, uint8_t bpp) {
+  const uint32_t bit = index * bpp;
+  return (progmem_read_byte(mask + bit / 8) >> (8 - bpp - bit % 8)) & ((1 << bpp) - 1);
+}
+
+void Display::horizontal_line(int x, int y, int width, Color color) { this->fill_span(x, y, width, color); }
 void HOT Display::vertical_line(int x, int y, int height, Color color) {
   // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
   for (int i = y; i < y + height; i++)
@@ -102,9 +130,8 @@ void Display::rectangle(int x1, int y1, int width, int height, Color color) {
   this->vertical_line(x1 + width - 1, y1, height, color);
 }
 void Display::filled_rectangle(int x1, int y1, int width, int height, Color color) {
-  // Future: Use vertical_line and horizontal_line methods depending on rotation to reduce memory accesses.
   for (int i = y1; i < y1 + height; i++) {
-    this->horizontal_line(x1, i, width, color);
+    this->fill_span(x1, i, width, color);
   }
 }
 void HOT Display::circle(int center_x, int center_xy, int radius, Color color) {
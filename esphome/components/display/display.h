@@ -256,6 +256,23 @@ class Display : public PollingComponent {
     this->draw_pixels_at(x_start, y_start, w, h, ptr, order, bitness, big_endian, 0, 0, 0);
   }
 
+  /// Fill the horizontal span from the point [x,y] to [x+width,y] with the given color.
+  virtual void fill_span(int x, int y, int width, Color color);
+
+  /** Draw a rectangle of pixels with its top left point at [x,y].
+   *
+   * \param colors The colors of the pixels, row by row. Pixels with an alpha (w) below 0x80 are left unchanged.
+   */
+  virtual void blit_rect(int x, int y, int width, int height, const Color *colors);
+
+  /** Draw a rectangle of pixels with its top left point at [x,y] by blending color over background.
+   *
+   * \param mask The alpha value of every pixel with bpp (1, 2, 4 or 8) bits per pixel, packed most significant bit
+   * first without padding at the end of the rows. It may be stored in flash. Pixels with alpha 0 are left unchanged.
+   */
+  virtual void blit_alpha_mask(int x, int y, int width, int height, const uint8_t *mask, uint8_t bpp, Color color,
+                               Color background);
+
   /// Draw a straight line from the point [x1,y1] to [x2,y2] with the given color.
   void line(int x1, int y1, int x2, int y2, Color color = COLOR_ON);
 
@@ -636,6 +653,9 @@ class Display : public PollingComponent {
   void show_test_card() { this->show_test_card_ = true; }
 
  protected:
+  /// Return the alpha value of the pixel at index in a mask as taken by blit_alpha_mask().
+  static uint8_t alpha_mask_value_(const uint8_t *mask, uint32_t index, uint8_t bpp);
+
   bool clamp_x_(int x, int w, int &min_x, int &max_x);
   bool clamp_y_(int y, int h, int &min_y, int &max_y);
   void vprintf_(int x, int y, BaseFont *font, Color color, Color background, TextAlign align, const char *format,
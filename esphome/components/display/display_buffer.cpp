@@ -1,5 +1,7 @@
 #include "display_buffer.h"
 
+#include <algorithm>
+#include <cinttypes>
 #include <utility>
 
 #include "esphome/core/application.h"
@@ -10,6 +12,63 @@ namespace display {
 
 static const char *const TAG = "display";
 
+static int32_t area(const Rect &rect) { return int32_t(rect.w) * rect.h; }
+
+void DirtyRegions::add(int x, int y, int width, int height) {
+  if (width <= 0 || height <= 0)
+    return;
+  Rect rect(x, y, width, height);
+  uint8_t i = 0;
+  while (i < this->count_) {
+    const Rect &region = this->regions_[i];
+    if (region.x <= rect.x && region.y <= rect.y && region.x2() >= rect.x2() && region.y2() >= rect.y2())
+      return;
+    if (region.x <= rect.x2() && rect.x <= region.x2() && region.y <= rect.y2() && rect.y <= region.y2()) {
+      // Overlapping or adjacent, merge the region and check the grown rectangle against all regions again
+      rect.extend(region);
+      this->regions_[i] = this->regions_[--this->count_];
+      i = 0;
+      continue;
+    }
+    i++;
+  }
+  this->regions_[this->count_++] = rect;
+  if (this->count_ > MAX_REGIONS)
+    this->merge_closest_();
+}
+
+void DirtyRegions::merge_closest_() {
+  uint8_t best_a = 0, best_b = 1;
+  int32_t best_cost = INT32_MAX;
+  for (uint8_t a = 0; a < this->count_; a++) {
+    for (uint8_t b = a + 1; b < this->count_; b++) {
+      Rect merged = this->regions_[a];
+      merged.extend(this->regions_[b]);
+      int32_t cost = area(merged) - area(this->regions_[a]) - area(this->regions_[b]);
+      if (cost < best_cost) {
+        best_cost = cost;
+        best_a = a;
+        best_b = b;
+      }
+    }
+  }
+  this->regions_[best_a].extend(this->regions_[best_b]);
+  this->regions_[best_b] = this->regions_[--this->count_];
+}
+
+void DirtyRegions::end_frame() {
+  if (this->frame_bytes_ != 0) {
+    this->last_frame_bytes_ = this->frame_bytes_;
+    this->total_bytes_ += this->frame_bytes_;
+    this->frame_count_++;
+    ESP_LOGV(TAG, "Flushed %" PRIu32 " bytes in %u regions", this->frame_bytes_, this->count_);
+  } else {
+    this->last_frame_bytes_ = 0;
+  }
+  this->frame_bytes_ = 0;
+  this->clear();
+}
+
 void DisplayBuffer::init_internal_(uint32_t buffer_length) {
   ExternalRAMAllocator<uint8_t> allocator(ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE);
   this->buffer_ = allocator.allocate(buffer_length);
@@ -68,5 +127,120 @@ void HOT DisplayBuffer::draw_pixel_at(int x, int y, Color color) {
   App.feed_wdt();
 }
 
+void HOT DisplayBuffer::fill_span(int x, int y, int width, Color color) {
+  if (this->clip_span_(x, y, width) < 0)
+    return;
+  int step_x, step_y;
+  this->to_absolute_(x, y, step_x, step_y);
+  // The span runs along a row or a column of the display, depending on the rotation
+  if (step_x != 0) {
+    this->fill_absolute_rect_internal(step_x > 0 ? x : x - width + 1, y, width, 1, color);
+  } else {
+    this->fill_absolute_rect_internal(x, step_y > 0 ? y : y - width + 1, 1, width, color);
+  }
+  App.feed_wdt();
+}
+
+void HOT DisplayBuffer::blit_rect(int x, int y, int width, int height, const Color *colors) {
+  for (int row = 0; row < height; row++, colors += width) {
+    int span_x = x;
+    int span_width = width;
+    int skip = this->clip_span_(span_x, y + row, span_width);
+    if (skip < 0)
+      continue;
+    int abs_x = span_x, abs_y = y + row, step_x, step_y;
+    this->to_absolute_(abs_x, abs_y, step_x, step_y);
+    for (const Color *color = colors + skip; span_width != 0; span_width--, color++) {
+      if (color->w >= 0x80)
+        this->draw_absolute_pixel_internal(abs_x, abs_y, *color);
+      abs_x += step_x;
+      abs_y += step_y;
+    }
+  }
+  App.feed_wdt();
+}
+
+void HOT DisplayBuffer::blit_alpha_mask(int x, int y, int width, int height, const uint8_t *mask, uint8_t bpp,
+                                        Color color, Color background) {
+  const uint8_t max_alpha = (1 << bpp) - 1;
+  for (int row = 0; row < height; row++) {
+    int span_x = x;
+    int span_width = width;
+    int skip = this->clip_span_(span_x, y + row, span_width);
+    if (skip < 0)
+      continue;
+    int abs_x = span_x, abs_y = y + row, step_x, step_y;
+    this->to_absolute_(abs_x, abs_y, step_x, step_y);
+    uint32_t index = row * width + skip;
+    for (; span_width != 0; span_width--, index++) {
+      uint8_t alpha = alpha_mask_value_(mask, index, bpp);
+      if (alpha == max_alpha) {
+        this->draw_absolute_pixel_internal(abs_x, abs_y, color);
+      } else if (alpha != 0) {
+        this->draw_absolute_pixel_internal(abs_x, abs_y, ColorUtil::blend(background, color, alpha, max_alpha));
+      }
+      abs_x += step_x;
+      abs_y += step_y;
+    }
+  }
+  App.feed_wdt();
+}
+
+void DisplayBuffer::fill_absolute_rect_internal(int x, int y, int width, int height, Color color) {
+  for (int abs_y = y; abs_y < y + height; abs_y++) {
+    for (int abs_x = x; abs_x < x + width; abs_x++)
+      this->draw_absolute_pixel_internal(abs_x, abs_y, color);
+  }
+}
+
+int DisplayBuffer::clip_span_(int &x, int y, int &width) {
+  if (y < 0 || y >= this->get_height())
+    return -1;
+  int min_x = std::max(x, 0);
+  int max_x = std::min(x + width, this->get_width());
+  // Like draw_pixel_at(), which includes the right and bottom edge of the clipping rectangle
+  Rect clipping = this->get_clipping();
+  if (clipping.is_set()) {
+    if (y < clipping.y || y > clipping.y2())
+      return -1;
+    min_x = std::max(min_x, (int) clipping.x);
+    max_x = std::min(max_x, clipping.x2() + 1);
+  }
+  if (min_x >= max_x)
+    return -1;
+  int skip = min_x - x;
+  x = min_x;
+  width = max_x - min_x;
+  return skip;
+}
+
+void DisplayBuffer::to_absolute_(int &x, int &y, int &step_x, int &step_y) {
+  switch (this->rotation_) {
+    case DISPLAY_ROTATION_0_DEGREES:
+    default:
+      step_x = 1;
+      step_y = 0;
+      break;
+    case DISPLAY_ROTATION_90_DEGREES:
+      std::swap(x, y);
+      x = this->get_width_internal() - x - 1;
+      step_x = 0;
+      step_y = 1;
+      break;
+    case DISPLAY_ROTATION_180_DEGREES:
+      x = this->get_width_internal() - x - 1;
+      y = this->get_height_internal() - y - 1;
+      step_x = -1;
+      step_y = 0;
+      break;
+    case DISPLAY_ROTATION_270_DEGREES:
+      std::swap(x, y);
+      y = this->get_height_internal() - y - 1;
+      step_x = 0;
+      step_y = -1;
+      break;
+  }
+}
+
 }  // namespace display
 }  // namespace esphome
@@ -12,6 +12,46 @@
 namespace esphome {
 namespace display {
 
+/** Collects the regions of a display buffer that changed, so a driver can flush only those to the panel.
+ *
+ * The regions are kept in absolute (unrotated) coordinates. A changed area that touches a region is merged into it.
+ * When there are more than MAX_REGIONS regions, the two regions whose bounding box adds the least area are merged.
+ */
+class DirtyRegions {
+ public:
+  static const uint8_t MAX_REGIONS = 8;
+
+  /// Mark the rectangle as changed.
+  void add(int x, int y, int width, int height);
+  /// Forget all regions, e.g. after they were flushed.
+  void clear() { this->count_ = 0; }
+  bool empty() const { return this->count_ == 0; }
+  const Rect *begin() const { return this->regions_; }
+  const Rect *end() const { return this->regions_ + this->count_; }
+
+  /// Count bytes sent to the panel for the current frame.
+  void add_flushed_bytes(size_t bytes) { this->frame_bytes_ += bytes; }
+  /// Finish the current frame: update the statistics and clear the regions.
+  void end_frame();
+  /// Number of bytes sent to the panel for the last frame.
+  uint32_t get_last_frame_bytes() const { return this->last_frame_bytes_; }
+  /// Number of bytes sent to the panel for all frames.
+  uint64_t get_total_bytes() const { return this->total_bytes_; }
+  /// Number of frames that sent any bytes to the panel.
+  uint32_t get_frame_count() const { return this->frame_count_; }
+
+ protected:
+  void merge_closest_();
+
+  /// One spare slot for the region that is merged when the list is full.
+  Rect regions_[MAX_REGIONS + 1];
+  uint8_t count_{0};
+  uint32_t frame_bytes_{0};
+  uint32_t last_frame_bytes_{0};
+  uint64_t total_bytes_{0};
+  uint32_t frame_count_{0};
+};
+
 class DisplayBuffer : public Display {
  public:
   /// Get the width of the image in pixels with rotation applied.
@@ -19,15 +59,42 @@ class DisplayBuffer : public Display {
   /// Get the height of the image in pixels with rotation applied.
   int get_height() override;
 
+  /// The changed regions and flush statistics, for drivers that track them.
+  const DirtyRegions &get_dirty_regions() const { return this->dirty_regions_; }
+
   /// Set a single pixel at the specified coordinates to the given color.
   void draw_pixel_at(int x, int y, Color color) override;
 
+  // The span primitives clip and rotate once per row instead of once per pixel.
+  void fill_span(int x, int y, int width, Color color) override;
+  void blit_rect(int x, int y, int width, int height, const Color *colors) override;
+  void blit_alpha_mask(int x, int y, int width, int height, const uint8_t *mask, uint8_t bpp, Color color,
+                       Color background) override;
+
  protected:
   virtual void draw_absolute_pixel_internal(int x, int y, Color color) = 0;
+  /** Fill a rectangle in absolute (unrotated) coordinates, which is always inside the display.
+   *
+   * The default implementation draws every pixel, drivers should override it to write to their buffer directly.
+   */
+  virtual void fill_absolute_rect_internal(int x, int y, int width, int height, Color color);
+
+  /** Clip the span of width pixels from [x,y] to the display and the clipping rectangle.
+   *
+   * @return The number of pixels skipped at the start of the span, or -1 when nothing of it is visible.
+   */
+  int clip_span_(int &x, int y, int &width);
+  /** Convert the point [x,y] to absolute coordinates.
+   *
+   * step_x and step_y are set to the absolute direction of the next pixel of a horizontal span.
+   */
+  void to_absolute_(int &x, int &y, int &step_x, int &step_y);
 
   void init_internal_(uint32_t buffer_length);
 
   uint8_t *buffer_{nullptr};
+  /// The changed parts of the buffer, for drivers that only flush those. Drivers have to add them when writing.
+  DirtyRegions dirty_regions_;
 };
 
 }  // namespace display
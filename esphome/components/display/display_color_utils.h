@@ -154,6 +154,20 @@ class ColorUtil {
     Color color = Color(palette[index * 3 + 0], palette[index * 3 + 1], palette[index * 3 + 2], 0);
     return color;
   }
+  /***
+   * Blends a color over a background, e.g. for anti-aliased fonts.
+   * @param[in] background The color at alpha 0.
+   * @param[in] color The color at alpha max_alpha.
+   * @param[in] alpha The alpha value, from 0 to max_alpha.
+   * @param[in] max_alpha The alpha value of a fully opaque color.
+   * @return The blended Color object.
+   */
+  static Color blend(Color background, Color color, uint8_t alpha, uint8_t max_alpha) {
+    const uint32_t inverse = max_alpha - alpha;
+    return Color((background.r * inverse + color.r * alpha) / max_alpha,
+                 (background.g * inverse + color.g * alpha) / max_alpha,
+                 (background.b * inverse + color.b * alpha) / max_alpha);
+  }
 };
 }  // namespace display
 }  // namespace esphome
@@ -2,10 +2,19 @@ import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.components.light.types import AddressableLightEffect
 from esphome.components.light.effects import register_addressable_effect
-from esphome.const import CONF_ID, CONF_NAME, CONF_METHOD, CONF_CHANNELS
+from esphome.const import (
+    CONF_ID,
+    CONF_NAME,
+    CONF_METHOD,
+    CONF_CHANNELS,
+    CONF_PROTOCOL,
+    CONF_EFFECTS,
+)
+import esphome.final_validate as fv
 
 AUTO_LOAD = ["socket"]
 DEPENDENCIES = ["network"]
+MULTI_CONF = True
 
 e131_ns = cg.esphome_ns.namespace("e131")
 E131AddressableLightEffect = e131_ns.class_(
@@ -15,12 +24,23 @@ E131Component = e131_ns.class_("E131Component", cg.Component)
 
 METHODS = {"UNICAST": e131_ns.E131_UNICAST, "MULTICAST": e131_ns.E131_MULTICAST}
 
+PROTOCOLS = {
+    "E131": e131_ns.E131_PROTOCOL_E131,
+    "ARTNET": e131_ns.E131_PROTOCOL_ARTNET,
+}
+
 CHANNELS = {
     "MONO": e131_ns.E131_MONO,
     "RGB": e131_ns.E131_RGB,
     "RGBW": e131_ns.E131_RGBW,
 }
 
+# First and last universe each protocol can address, Art-Net port addresses are 15 bit
+UNIVERSE_RANGES = {
+    "E131": (1, 512),
+    "ARTNET": (0, 32767),
+}
+
 CONF_UNIVERSE = "universe"
 CONF_E131_ID = "e131_id"
 
@@ -28,14 +48,41 @@ CONFIG_SCHEMA = cv.Schema(
     {
         cv.GenerateID(): cv.declare_id(E131Component),
         cv.Optional(CONF_METHOD, default="MULTICAST"): cv.one_of(*METHODS, upper=True),
+        cv.Optional(CONF_PROTOCOL, default="E131"): cv.one_of(*PROTOCOLS, upper=True),
     }
 )
 
 
+def _final_validate(config):
+    low, high = UNIVERSE_RANGES[config[CONF_PROTOCOL]]
+    for light_index, light_conf in enumerate(fv.full_config.get().get("light", [])):
+        for effect_index, effect in enumerate(light_conf.get(CONF_EFFECTS, [])):
+            effect_conf = effect.get("e131")
+            if effect_conf is None or effect_conf[CONF_E131_ID] != config[CONF_ID]:
+                continue
+            if not low <= effect_conf[CONF_UNIVERSE] <= high:
+                raise cv.Invalid(
+                    f"Universe must be in range {low} to {high} for protocol "
+                    f"{config[CONF_PROTOCOL]}",
+                    path=[
+                        "light",
+                        light_index,
+                        CONF_EFFECTS,
+                        effect_index,
+                        "e131",
+                        CONF_UNIVERSE,
+                    ],
+                )
+
+
+FINAL_VALIDATE_SCHEMA = _final_validate
+
+
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
     cg.add(var.set_method(METHODS[config[CONF_METHOD]]))
+    cg.add(var.set_protocol(PROTOCOLS[config[CONF_PROTOCOL]]))
 
 
 @register_addressable_effect(
@@ -44,7 +91,8 @@ async def to_code(config):
     "E1.31",
     {
         cv.GenerateID(CONF_E131_ID): cv.use_id(E131Component),
-        cv.Required(CONF_UNIVERSE): cv.int_range(min=1, max=512),
+        # Checked against the protocol of the e131 component in _final_validate
+        cv.Required(CONF_UNIVERSE): cv.int_range(min=0, max=32767),
         cv.Optional(CONF_CHANNELS, default="RGB"): cv.one_of(*CHANNELS, upper=True),
     },
 )
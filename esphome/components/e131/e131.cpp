@@ -3,11 +3,16 @@
 #include "e131_addressable_light_effect.h"
 #include "esphome/core/log.h"
 
+#include <algorithm>
+
 namespace esphome {
 namespace e131 {
 
 static const char *const TAG = "e131";
 static const int PORT = 5568;
+static const int ARTNET_PORT = 6454;
+// Upper bound on datagrams handled per loop() call, so a flood of packets can't starve other components
+static const uint8_t MAX_PACKETS_PER_LOOP = 32;
 
 E131Component::E131Component() {}
 
@@ -35,7 +40,8 @@ void E131Component::setup() {
 
   struct sockaddr_storage server;
 
-  socklen_t sl = socket::set_sockaddr_any((struct sockaddr *) &server, sizeof(server), PORT);
+  socklen_t sl = socket::set_sockaddr_any((struct sockaddr *) &server, sizeof(server),
+                                          this->protocol_ == E131_PROTOCOL_ARTNET ? ARTNET_PORT : PORT);
   if (sl == 0) {
     ESP_LOGW(TAG, "Socket unable to set sockaddr: errno %d", errno);
     this->mark_failed();
@@ -53,37 +59,38 @@ void E131Component::setup() {
 }
 
 void E131Component::loop() {
-  std::vector<uint8_t> payload;
   E131Packet packet;
   int universe = 0;
   uint8_t buf[1460];
 
-  ssize_t len = this->socket_->read(buf, sizeof(buf));
-  if (len == -1) {
-    return;
-  }
-  payload.resize(len);
-  memmove(&payload[0], buf, len);
-
-  if (!this->packet_(payload, universe, packet)) {
-    ESP_LOGV(TAG, "Invalid packet received of size %zu.", payload.size());
-    return;
-  }
-
-  if (!this->process_(universe, packet)) {
-    ESP_LOGV(TAG, "Ignored packet for %d universe of size %d.", universe, packet.count);
+  // Drain everything that arrived since the last loop, installations spanning many universes send a burst of packets
+  // per frame.
+  for (uint8_t i = 0; i < MAX_PACKETS_PER_LOOP; i++) {
+    ssize_t len = this->socket_->read(buf, sizeof(buf));
+    if (len <= 0) {
+      return;
+    }
+
+    if (!this->packet_(buf, len, universe, packet)) {
+      ESP_LOGV(TAG, "Invalid packet received of size %zd.", len);
+      continue;
+    }
+
+    if (!this->process_(universe, packet)) {
+      ESP_LOGV(TAG, "Ignored packet for %d universe of size %d.", universe, packet.count);
+    }
   }
 }
 
 void E131Component::add_effect(E131AddressableLightEffect *light_effect) {
-  if (light_effects_.count(light_effect)) {
+  if (std::find(light_effects_.begin(), light_effects_.end(), light_effect) != light_effects_.end()) {
     return;
   }
 
   ESP_LOGD(TAG, "Registering '%s' for universes %d-%d.", light_effect->get_name().c_str(),
            light_effect->get_first_universe(), light_effect->get_last_universe());
 
-  light_effects_.insert(light_effect);
+  light_effects_.push_back(light_effect);
 
   for (auto universe = light_effect->get_first_universe(); universe <= light_effect->get_last_universe(); ++universe) {
     join_(universe);
@@ -91,14 +98,15 @@ void E131Component::add_effect(E131AddressableLightEffect *light_effect) {
 }
 
 void E131Component::remove_effect(E131AddressableLightEffect *light_effect) {
-  if (!light_effects_.count(light_effect)) {
+  auto it = std::find(light_effects_.begin(), light_effects_.end(), light_effect);
+  if (it == light_effects_.end()) {
     return;
   }
 
   ESP_LOGD(TAG, "Unregistering '%s' for universes %d-%d.", light_effect->get_name().c_str(),
            light_effect->get_first_universe(), light_effect->get_last_universe());
 
-  light_effects_.erase(light_effect);
+  light_effects_.erase(it);
 
   for (auto universe = light_effect->get_first_universe(); universe <= light_effect->get_last_universe(); ++universe) {
     leave_(universe);
@@ -108,7 +116,7 @@ void E131Component::remove_effect(E131AddressableLightEffect *light_effect) {
 bool E131Component::process_(int universe, const E131Packet &packet) {
   bool handled = false;
 
-  ESP_LOGV(TAG, "Received E1.31 packet for %d universe, with %d bytes", universe, packet.count);
+  ESP_LOGV(TAG, "Received DMX packet for %d universe, with %d slots", universe, packet.count);
 
   for (auto *light_effect : light_effects_) {
     handled = light_effect->process_(universe, packet) || handled;
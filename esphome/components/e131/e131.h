@@ -7,7 +7,6 @@
 #include <cinttypes>
 #include <map>
 #include <memory>
-#include <set>
 #include <vector>
 
 namespace esphome {
@@ -16,12 +15,15 @@ namespace e131 {
 class E131AddressableLightEffect;
 
 enum E131ListenMethod { E131_MULTICAST, E131_UNICAST };
+enum E131Protocol { E131_PROTOCOL_E131, E131_PROTOCOL_ARTNET };
 
 const int E131_MAX_PROPERTY_VALUES_COUNT = 513;
 
+/// DMX data of a received packet. Points into the receive buffer, so it is only valid while the packet is processed.
 struct E131Packet {
+  /// Number of DMX slots, excluding the start code.
   uint16_t count;
-  uint8_t values[E131_MAX_PROPERTY_VALUES_COUNT];
+  const uint8_t *values;
 };
 
 class E131Component : public esphome::Component {
@@ -37,19 +39,25 @@ class E131Component : public esphome::Component {
   void remove_effect(E131AddressableLightEffect *light_effect);
 
   void set_method(E131ListenMethod listen_method) { this->listen_method_ = listen_method; }
+  void set_protocol(E131Protocol protocol) { this->protocol_ = protocol; }
 
  protected:
-  bool packet_(const std::vector<uint8_t> &data, int &universe, E131Packet &packet);
+  bool packet_(const uint8_t *data, size_t len, int &universe, E131Packet &packet);
+  bool e131_packet_(const uint8_t *data, size_t len, int &universe, E131Packet &packet);
+  bool artnet_packet_(const uint8_t *data, size_t len, int &universe, E131Packet &packet);
+  bool uses_multicast_() const {
+    return this->protocol_ == E131_PROTOCOL_E131 && this->listen_method_ == E131_MULTICAST;
+  }
   bool process_(int universe, const E131Packet &packet);
   bool join_igmp_groups_();
   void join_(int universe);
   void leave_(int universe);
 
   E131ListenMethod listen_method_{E131_MULTICAST};
+  E131Protocol protocol_{E131_PROTOCOL_E131};
   std::unique_ptr<socket::Socket> socket_;
-  std::set<E131AddressableLightEffect *> light_effects_;
+  std::vector<E131AddressableLightEffect *> light_effects_;
   std::map<int, int> universe_consumers_;
-  std::map<int, E131Packet> universe_packets_;
 };
 
 }  // namespace e131
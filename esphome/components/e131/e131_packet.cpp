@@ -20,6 +20,10 @@ static const uint32_t VECTOR_ROOT = 4;
 static const uint32_t VECTOR_FRAME = 2;
 static const uint8_t VECTOR_DMP = 2;
 
+static const uint8_t ARTNET_ID[8] = {'A', 'r', 't', '-', 'N', 'e', 't', 0x00};
+static const uint16_t ARTNET_OPCODE_DMX = 0x5000;
+static const size_t ARTNET_HEADER_SIZE = 18;
+
 // E1.31 Packet Structure
 union E131RawPacket {
   struct {
@@ -59,7 +63,7 @@ union E131RawPacket {
 const size_t E131_MIN_PACKET_SIZE = reinterpret_cast<size_t>(&((E131RawPacket *) nullptr)->property_values[1]);
 
 bool E131Component::join_igmp_groups_() {
-  if (listen_method_ != E131_MULTICAST)
+  if (!this->uses_multicast_())
     return false;
   if (this->socket_ == nullptr)
     return false;
@@ -101,7 +105,7 @@ void E131Component::leave_(int universe) {
     return;  // we have other consumers of the given universe
   }
 
-  if (listen_method_ == E131_MULTICAST) {
+  if (this->uses_multicast_()) {
     ip4_addr_t multicast_addr = network::IPAddress(239, 255, ((universe >> 8) & 0xff), ((universe >> 0) & 0xff));
 
     igmp_leavegroup(IP4_ADDR_ANY4, &multicast_addr);
@@ -110,11 +114,17 @@ void E131Component::leave_(int universe) {
   ESP_LOGD(TAG, "Left %d universe for E1.31.", universe);
 }
 
-bool E131Component::packet_(const std::vector<uint8_t> &data, int &universe, E131Packet &packet) {
-  if (data.size() < E131_MIN_PACKET_SIZE)
+bool E131Component::packet_(const uint8_t *data, size_t len, int &universe, E131Packet &packet) {
+  if (this->protocol_ == E131_PROTOCOL_ARTNET)
+    return this->artnet_packet_(data, len, universe, packet);
+  return this->e131_packet_(data, len, universe, packet);
+}
+
+bool E131Component::e131_packet_(const uint8_t *data, size_t len, int &universe, E131Packet &packet) {
+  if (len < E131_MIN_PACKET_SIZE)
     return false;
 
-  auto *sbuff = reinterpret_cast<const E131RawPacket *>(&data[0]);
+  auto *sbuff = reinterpret_cast<const E131RawPacket *>(data);
 
   if (memcmp(sbuff->acn_id, ACN_ID, sizeof(sbuff->acn_id)) != 0)
     return false;
@@ -128,11 +138,35 @@ bool E131Component::packet_(const std::vector<uint8_t> &data, int &universe, E13
     return false;
 
   universe = htons(sbuff->universe);
-  packet.count = htons(sbuff->property_value_count);
-  if (packet.count > E131_MAX_PROPERTY_VALUES_COUNT)
+  uint16_t count = htons(sbuff->property_value_count);
+  if (count == 0 || count > E131_MAX_PROPERTY_VALUES_COUNT)
+    return false;
+  if (E131_MIN_PACKET_SIZE - 1 + count > len)
+    return false;
+
+  // Skip the start code
+  packet.count = count - 1;
+  packet.values = &sbuff->property_values[1];
+  return true;
+}
+
+bool E131Component::artnet_packet_(const uint8_t *data, size_t len, int &universe, E131Packet &packet) {
+  if (len < ARTNET_HEADER_SIZE)
+    return false;
+  if (memcmp(data, ARTNET_ID, sizeof(ARTNET_ID)) != 0)
+    return false;
+  // OpCode is little endian, everything else big endian
+  if ((data[8] | (data[9] << 8)) != ARTNET_OPCODE_DMX)
+    return false;
+
+  // 15-bit port address made of SubUni and Net
+  universe = ((data[15] & 0x7F) << 8) | data[14];
+  uint16_t count = (data[16] << 8) | data[17];
+  if (count > E131_MAX_PROPERTY_VALUES_COUNT - 1 || ARTNET_HEADER_SIZE + count > len)
     return false;
 
-  memcpy(packet.values, sbuff->property_values, packet.count);
+  packet.count = count;
+  packet.values = data + ARTNET_HEADER_SIZE;
   return true;
 }
 
@@ -49,6 +49,7 @@ Glyph = font_ns.class_("Glyph")
 GlyphData = font_ns.struct("GlyphData")
 
 CONF_BPP = "bpp"
+CONF_CACHE_SIZE = "cache_size"
 CONF_EXTRAS = "extras"
 CONF_FONTS = "fonts"
 
@@ -323,6 +324,7 @@ FONT_SCHEMA = cv.Schema(
         cv.Optional(CONF_GLYPHS, default=DEFAULT_GLYPHS): validate_glyphs,
         cv.Optional(CONF_SIZE, default=20): cv.int_range(min=1),
         cv.Optional(CONF_BPP, default=1): cv.one_of(1, 2, 4, 8),
+        cv.Optional(CONF_CACHE_SIZE, default=0): cv.int_range(min=0, max=255),
         cv.Optional(CONF_EXTRAS): cv.ensure_list(
             cv.Schema(
                 {
@@ -528,7 +530,7 @@ async def to_code(config):
 
     glyphs = cg.static_const_array(config[CONF_RAW_GLYPH_ID], glyph_initializer)
 
-    cg.new_Pvariable(
+    var = cg.new_Pvariable(
         config[CONF_ID],
         glyphs,
         len(glyph_initializer),
@@ -536,3 +538,5 @@ async def to_code(config):
         font_list[0].ascent + font_list[0].descent,
         bpp,
     )
+    if config[CONF_CACHE_SIZE] > 0:
+        cg.add(var.set_cache_size(config[CONF_CACHE_SIZE]))
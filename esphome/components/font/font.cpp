@@ -1,5 +1,7 @@
 #include "font.h"
 
+#include <cstring>
+
 #include "esphome/core/hal.h"
 #include "esphome/core/log.h"
 #include "esphome/core/color.h"
@@ -49,10 +51,25 @@ void Glyph::scan_area(int *x1, int *y1, int *width, int *height) const {
 Font::Font(const GlyphData *data, int data_nr, int baseline, int height, uint8_t bpp)
     : baseline_(baseline), height_(height), bpp_(bpp) {
   glyphs_.reserve(data_nr);
-  for (int i = 0; i < data_nr; ++i)
+  memset(this->ascii_glyphs_, NO_ASCII_GLYPH, sizeof(this->ascii_glyphs_));
+  for (int i = 0; i < data_nr; ++i) {
     glyphs_.emplace_back(&data[i]);
+    const uint8_t *a_char = data[i].a_char;
+    if (a_char[0] == '\0' || a_char[0] >= 0x80)
+      continue;
+    // The glyphs are sorted, so a longer glyph starting with the same character comes later and needs the search
+    if (a_char[1] == '\0' && i < NO_ASCII_GLYPH) {
+      this->ascii_glyphs_[a_char[0]] = i;
+    } else {
+      this->ascii_glyphs_[a_char[0]] = NO_ASCII_GLYPH;
+    }
+  }
 }
 int Font::match_next_glyph(const uint8_t *str, int *match_length) {
+  if (str[0] < 0x80 && this->ascii_glyphs_[str[0]] != NO_ASCII_GLYPH) {
+    *match_length = 1;
+    return this->ascii_glyphs_[str[0]];
+  }
   int lo = 0;
   int hi = this->glyphs_.size() - 1;
   while (lo != hi) {
@@ -123,41 +140,13 @@ void Font::print(int x_start, int y_start, display::Display *display, Color colo
     const Glyph &glyph = this->get_glyphs()[glyph_n];
     glyph.scan_area(&scan_x1, &scan_y1, &scan_width, &scan_height);
 
-    const uint8_t *data = glyph.glyph_data_->data;
-    const int max_x = x_at + scan_x1 + scan_width;
-    const int max_y = y_start + scan_y1 + scan_height;
-
-    uint8_t bitmask = 0;
-    uint8_t pixel_data = 0;
-    uint8_t bpp_max = (1 << this->bpp_) - 1;
-    auto diff_r = (float) color.r - (float) background.r;
-    auto diff_g = (float) color.g - (float) background.g;
-    auto diff_b = (float) color.b - (float) background.b;
-    auto b_r = (float) background.r;
-    auto b_g = (float) background.g;
-    auto b_b = (float) background.g;
-    for (int glyph_y = y_start + scan_y1; glyph_y != max_y; glyph_y++) {
-      for (int glyph_x = x_at + scan_x1; glyph_x != max_x; glyph_x++) {
-        uint8_t pixel = 0;
-        for (int bit_num = 0; bit_num != this->bpp_; bit_num++) {
-          if (bitmask == 0) {
-            pixel_data = progmem_read_byte(data++);
-            bitmask = 0x80;
-          }
-          pixel <<= 1;
-          if ((pixel_data & bitmask) != 0)
-            pixel |= 1;
-          bitmask >>= 1;
-        }
-        if (pixel == bpp_max) {
-          display->draw_pixel_at(glyph_x, glyph_y, color);
-        } else if (pixel != 0) {
-          auto on = (float) pixel / (float) bpp_max;
-          auto blended =
-              Color((uint8_t) (diff_r * on + b_r), (uint8_t) (diff_g * on + b_g), (uint8_t) (diff_b * on + b_b));
-          display->draw_pixel_at(glyph_x, glyph_y, blended);
-        }
-      }
+    const GlyphCacheEntry *entry = this->get_cache_entry_(glyph_n, color, background);
+    if (entry != nullptr) {
+      for (const auto &span : entry->spans)
+        display->fill_span(x_at + scan_x1 + span.x, y_start + scan_y1 + span.y, span.length, span.color);
+    } else {
+      display->blit_alpha_mask(x_at + scan_x1, y_start + scan_y1, scan_width, scan_height, glyph.glyph_data_->data,
+                               this->bpp_, color, background);
     }
     x_at += glyph.glyph_data_->width + glyph.glyph_data_->offset_x;
 
@@ -165,5 +154,58 @@ void Font::print(int x_start, int y_start, display::Display *display, Color colo
   }
 }
 
+const GlyphCacheEntry *Font::get_cache_entry_(int glyph_n, Color color, Color background) {
+  if (this->glyph_cache_.empty())
+    return nullptr;
+  const GlyphData *data = this->glyphs_[glyph_n].glyph_data_;
+  // Spans store their position and length in a byte
+  if (data->width > 255 || data->height > 255)
+    return nullptr;
+
+  this->cache_tick_++;
+  GlyphCacheEntry *oldest = &this->glyph_cache_[0];
+  for (auto &entry : this->glyph_cache_) {
+    if (entry.glyph == glyph_n && entry.color == color && entry.background == background) {
+      entry.last_used = this->cache_tick_;
+      return &entry;
+    }
+    if (entry.last_used < oldest->last_used)
+      oldest = &entry;
+  }
+
+  // Split the rows of the glyph into runs of the same alpha value and blend each run once
+  GlyphCacheEntry &entry = *oldest;
+  entry.glyph = glyph_n;
+  entry.color = color;
+  entry.background = background;
+  entry.last_used = this->cache_tick_;
+  entry.spans.clear();
+  const uint8_t max_alpha = (1 << this->bpp_) - 1;
+  uint32_t bit = 0;
+  for (int y = 0; y < data->height; y++) {
+    int run_start = 0;
+    uint8_t run_alpha = 0;
+    for (int x = 0; x <= data->width; x++) {
+      uint8_t alpha = 0;
+      if (x != data->width) {
+        alpha = (progmem_read_byte(data->data + bit / 8) >> (8 - this->bpp_ - bit % 8)) & max_alpha;
+        bit += this->bpp_;
+      }
+      if (alpha == run_alpha && x != data->width)
+        continue;
+      if (run_alpha != 0) {
+        Color span_color = color;
+        if (run_alpha != max_alpha)
+          span_color = display::ColorUtil::blend(background, color, run_alpha, max_alpha);
+        entry.spans.push_back({(uint8_t) run_start, (uint8_t) y, (uint8_t) (x - run_start), span_color});
+      }
+      run_start = x;
+      run_alpha = alpha;
+    }
+  }
+  entry.spans.shrink_to_fit();
+  return &entry;
+}
+
 }  // namespace font
 }  // namespace esphome
@@ -38,6 +38,23 @@ class Glyph {
   const GlyphData *glyph_data_;
 };
 
+/// A run of pixels with the same color in a rendered glyph, relative to the glyph's scan area.
+struct GlyphSpan {
+  uint8_t x;
+  uint8_t y;
+  uint8_t length;
+  Color color;
+};
+
+/// A glyph rendered for one color and background.
+struct GlyphCacheEntry {
+  int glyph{-1};
+  Color color;
+  Color background;
+  uint32_t last_used{0};
+  std::vector<GlyphSpan> spans;
+};
+
 class Font : public display::BaseFont {
  public:
   /** Construct the font with the given glyphs.
@@ -57,10 +74,24 @@ class Font : public display::BaseFont {
   inline int get_height() { return this->height_; }
   inline int get_bpp() { return this->bpp_; }
 
+  /** Keep the spans of up to size rendered glyphs, so that repeated text is drawn without decoding and blending.
+   *
+   * The least recently used glyph is replaced when the cache is full. Each entry takes about 8 bytes per span.
+   */
+  void set_cache_size(uint8_t size) { this->glyph_cache_.resize(size); }
+
   const std::vector<Glyph, ExternalRAMAllocator<Glyph>> &get_glyphs() const { return glyphs_; }
 
  protected:
+  static const uint8_t NO_ASCII_GLYPH = 0xFF;
+
+  const GlyphCacheEntry *get_cache_entry_(int glyph_n, Color color, Color background);
+
   std::vector<Glyph, ExternalRAMAllocator<Glyph>> glyphs_;
+  /// Index of the glyph for each single ASCII character, or NO_ASCII_GLYPH to search the glyphs.
+  uint8_t ascii_glyphs_[128];
+  std::vector<GlyphCacheEntry> glyph_cache_;
+  uint32_t cache_tick_{0};
   int baseline_;
   int height_;
   uint8_t bpp_;  // bits per pixel
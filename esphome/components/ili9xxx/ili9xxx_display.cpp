@@ -57,10 +57,6 @@ void ILI9XXXDisplay::setup() {
 
   this->set_madctl();
   this->command(this->pre_invertcolors_ ? ILI9XXX_INVON : ILI9XXX_INVOFF);
-  this->x_low_ = this->width_;
-  this->y_low_ = this->height_;
-  this->x_high_ = 0;
-  this->y_high_ = 0;
 }
 
 void ILI9XXXDisplay::alloc_buffer_() {
@@ -131,10 +127,7 @@ void ILI9XXXDisplay::fill(Color color) {
   if (!this->check_buffer_())
     return;
   uint16_t new_color = 0;
-  this->x_low_ = 0;
-  this->y_low_ = 0;
-  this->x_high_ = this->get_width_internal() - 1;
-  this->y_high_ = this->get_height_internal() - 1;
+  this->dirty_regions_.add(0, 0, this->get_width_internal(), this->get_height_internal());
   switch (this->buffer_color_mode_) {
     case BITS_8_INDEXED:
       new_color = display::ColorUtil::color_to_index8_palette888(color, this->palette_);
@@ -194,17 +187,45 @@ void HOT ILI9XXXDisplay::draw_absolute_pixel_internal(int x, int y, Color color)
     this->buffer_[pos] = new_color;
     updated = true;
   }
-  if (updated) {
-    // low and high watermark may speed up drawing from buffer
-    if (x < this->x_low_)
-      this->x_low_ = x;
-    if (y < this->y_low_)
-      this->y_low_ = y;
-    if (x > this->x_high_)
-      this->x_high_ = x;
-    if (y > this->y_high_)
-      this->y_high_ = y;
+  // only the changed regions are sent to the display
+  if (updated)
+    this->dirty_regions_.add(x, y, 1, 1);
+}
+
+void HOT ILI9XXXDisplay::fill_absolute_rect_internal(int x, int y, int width, int height, Color color) {
+  if (!this->check_buffer_())
+    return;
+  bool updated = false;
+  if (this->buffer_color_mode_ == BITS_16) {
+    const uint16_t new_color = display::ColorUtil::color_to_565(color, display::ColorOrder::COLOR_ORDER_RGB);
+    const uint8_t high = new_color >> 8;
+    const uint8_t low = new_color & 0xFF;
+    for (int row = y; row < y + height; row++) {
+      uint8_t *pos = this->buffer_ + (row * this->width_ + x) * 2;
+      for (int i = 0; i < width; i++, pos += 2) {
+        if (pos[0] != high || pos[1] != low) {
+          pos[0] = high;
+          pos[1] = low;
+          updated = true;
+        }
+      }
+    }
+  } else {
+    const uint8_t new_color = this->buffer_color_mode_ == BITS_8_INDEXED
+                                  ? display::ColorUtil::color_to_index8_palette888(color, this->palette_)
+                                  : display::ColorUtil::color_to_332(color, display::ColorOrder::COLOR_ORDER_RGB);
+    for (int row = y; row < y + height; row++) {
+      uint8_t *pos = this->buffer_ + row * this->width_ + x;
+      for (int i = 0; i < width; i++, pos++) {
+        if (*pos != new_color) {
+          *pos = new_color;
+          updated = true;
+        }
+      }
+    }
   }
+  if (updated)
+    this->dirty_regions_.add(x, y, width, height);
 }
 
 void ILI9XXXDisplay::update() {
@@ -222,14 +243,15 @@ void ILI9XXXDisplay::update() {
 }
 
 void ILI9XXXDisplay::display_() {
-  // check if something was displayed
-  if ((this->x_high_ < this->x_low_) || (this->y_high_ < this->y_low_)) {
-    return;
-  }
+  // only the changed regions are sent to the display
+  for (const auto &region : this->dirty_regions_)
+    this->display_region_(region.x, region.y, region.x2() - 1, region.y2() - 1);
+  this->dirty_regions_.end_frame();
+}
 
-  // we will only update the changed rows to the display
-  size_t const w = this->x_high_ - this->x_low_ + 1;
-  size_t const h = this->y_high_ - this->y_low_ + 1;
+void ILI9XXXDisplay::display_region_(uint16_t x_low, uint16_t y_low, uint16_t x_high, uint16_t y_high) {
+  size_t const w = x_high - x_low + 1;
+  size_t const h = y_high - y_low + 1;
 
   size_t mhz = this->data_rate_ / 1000000;
   // estimate time for a single write
@@ -239,22 +261,22 @@ void ILI9XXXDisplay::display_() {
   ESP_LOGV(TAG,
            "Start display(xlow:%d, ylow:%d, xhigh:%d, yhigh:%d, width:%d, "
            "height:%zu, mode=%d, 18bit=%d, sw_time=%zuus, mw_time=%zuus)",
-           this->x_low_, this->y_low_, this->x_high_, this->y_high_, w, h, this->buffer_color_mode_,
-           this->is_18bitdisplay_, sw_time, mw_time);
+           x_low, y_low, x_high, y_high, w, h, this->buffer_color_mode_, this->is_18bitdisplay_, sw_time, mw_time);
   auto now = millis();
   if (this->buffer_color_mode_ == BITS_16 && !this->is_18bitdisplay_ && sw_time < mw_time) {
     // 16 bit mode maps directly to display format
     ESP_LOGV(TAG, "Doing single write of %zu bytes", this->width_ * h * 2);
-    set_addr_window_(0, this->y_low_, this->width_ - 1, this->y_high_);
-    this->write_array(this->buffer_ + this->y_low_ * this->width_ * 2, h * this->width_ * 2);
+    set_addr_window_(0, y_low, this->width_ - 1, y_high);
+    this->write_array(this->buffer_ + y_low * this->width_ * 2, h * this->width_ * 2);
+    this->dirty_regions_.add_flushed_bytes(h * this->width_ * 2);
   } else {
     ESP_LOGV(TAG, "Doing multiple write");
     uint8_t transfer_buffer[ILI9XXX_TRANSFER_BUFFER_SIZE];
     size_t rem = h * w;  // remaining number of pixels to write
-    set_addr_window_(this->x_low_, this->y_low_, this->x_high_, this->y_high_);
+    set_addr_window_(x_low, y_low, x_high, y_high);
     size_t idx = 0;    // index into transfer_buffer
     size_t pixel = 0;  // pixel number offset
-    size_t pos = this->y_low_ * this->width_ + this->x_low_;
+    size_t pos = y_low * this->width_ + x_low;
     while (rem-- != 0) {
       uint16_t color_val;
       switch (this->buffer_color_mode_) {
@@ -280,6 +302,7 @@ void ILI9XXXDisplay::display_() {
       }
       if (idx == sizeof(transfer_buffer)) {
         this->write_array(transfer_buffer, idx);
+        this->dirty_regions_.add_flushed_bytes(idx);
         idx = 0;
         App.feed_wdt();
       }
@@ -292,15 +315,11 @@ void ILI9XXXDisplay::display_() {
     // flush any balance.
     if (idx != 0) {
       this->write_array(transfer_buffer, idx);
+      this->dirty_regions_.add_flushed_bytes(idx);
     }
   }
   this->end_data_();
   ESP_LOGV(TAG, "Data write took %dms", (unsigned) (millis() - now));
-  // invalidate watermarks
-  this->x_low_ = this->width_;
-  this->y_low_ = this->height_;
-  this->x_high_ = 0;
-  this->y_high_ = 0;
 }
 
 // note that this bypasses the buffer and writes directly to the display.
@@ -27,6 +27,8 @@ from esphome.const import (
 )
 from esphome.core import CORE, HexInt
 
+from .compression import compress_image, unit_size
+
 _LOGGER = logging.getLogger(__name__)
 
 DOMAIN = "image"
@@ -47,6 +49,7 @@ IMAGE_TYPE = {
 }
 
 CONF_USE_TRANSPARENCY = "use_transparency"
+CONF_COMPRESS = "compress"
 
 # If the MDI file cannot be downloaded within this time, abort.
 IMAGE_DOWNLOAD_TIMEOUT = 30  # seconds
@@ -228,6 +231,7 @@ IMAGE_SCHEMA = cv.Schema(
             cv.Optional(CONF_DITHER, default="NONE"): cv.one_of(
                 "NONE", "FLOYDSTEINBERG", upper=True
             ),
+            cv.Optional(CONF_COMPRESS, default=False): cv.boolean,
             cv.GenerateID(CONF_RAW_DATA_ID): cv.declare_id(cg.uint8),
         },
         validate_cross_dependencies,
@@ -403,9 +407,21 @@ async def to_code(config):
             f"Image f{config[CONF_ID]} has an unsupported type: {config[CONF_TYPE]}."
         )
 
+    compress = config[CONF_COMPRESS]
+    if compress:
+        raw_size = len(data)
+        data = compress_image(
+            data, raw_size // height, height, unit_size(config[CONF_TYPE])
+        )
+        _LOGGER.debug(
+            "%s compressed from %d to %d bytes", config[CONF_ID], raw_size, len(data)
+        )
+
     rhs = [HexInt(x) for x in data]
     prog_arr = cg.progmem_array(config[CONF_RAW_DATA_ID], rhs)
     var = cg.new_Pvariable(
         config[CONF_ID], prog_arr, width, height, IMAGE_TYPE[config[CONF_TYPE]]
     )
     cg.add(var.set_transparency(transparent))
+    if compress:
+        cg.add(var.set_compressed(True))
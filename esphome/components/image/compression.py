@@ -0,0 +1,120 @@
+"""Run-length compression of image data, decoded row by row by image::RowDecoder.
+
+Each row is encoded on its own as a sequence of runs of units, where a unit is a pixel,
+or a byte of pixels for binary images. A run starts with a header byte, whose top two
+bits select the kind of run and whose low six bits are the number of units - 1.
+
+Compressed animations start with a table of the offsets of their frames as 32 bit little
+endian values. Frames between key frames only store what changed from the frame before.
+"""
+
+from __future__ import annotations
+
+RUN_LITERAL = 0x00
+RUN_REPEAT = 0x40
+RUN_UNCHANGED = 0x80
+MAX_RUN = 64
+
+# A frame can depend on this many frames at most, it has to fit image::MAX_ROW_DECODERS
+KEY_FRAME_INTERVAL = 8
+KEY_FRAME_FLAG = 0x80000000
+
+
+def unit_size(image_type: str) -> int:
+    """Size in bytes of the units the rows of the image type are encoded in."""
+    return {
+        "GRAYSCALE": 1,
+        "RGB565": 2,
+        "RGB24": 3,
+        "RGBA": 4,
+    }.get(image_type, 1)
+
+
+def _emit_runs(out: list[int], kind: int, count: int, unit: bytes = b"") -> None:
+    while count > 0:
+        length = min(count, MAX_RUN)
+        out.append(kind | (length - 1))
+        out.extend(unit)
+        count -= length
+
+
+def encode_row(row: bytes, unit: int, previous: bytes | None = None) -> list[int]:
+    """Encode the row, with runs unchanged from the previous frame's row if given."""
+    units = [bytes(row[i : i + unit]) for i in range(0, len(row), unit)]
+    previous_units = (
+        None
+        if previous is None
+        else [bytes(previous[i : i + unit]) for i in range(0, len(previous), unit)]
+    )
+    out: list[int] = []
+    literal: list[bytes] = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:MAX_RUN]
+            del literal[:MAX_RUN]
+            out.append(RUN_LITERAL | (len(chunk) - 1))
+            for value in chunk:
+                out.extend(value)
+
+    pos = 0
+    while pos < len(units):
+        if previous_units is not None and units[pos] == previous_units[pos]:
+            end = pos + 1
+            while end < len(units) and units[end] == previous_units[end]:
+                end += 1
+            # Worth a header of its own when it saves more than a byte
+            if (end - pos) * unit >= 2:
+                flush_literal()
+                _emit_runs(out, RUN_UNCHANGED, end - pos)
+                pos = end
+                continue
+
+        end = pos + 1
+        while end < len(units) and units[end] == units[pos]:
+            end += 1
+        if (end - pos - 1) * unit >= 2:
+            flush_literal()
+            _emit_runs(out, RUN_REPEAT, end - pos, units[pos])
+            pos = end
+            continue
+
+        literal.append(units[pos])
+        pos += 1
+    flush_literal()
+    return out
+
+
+def compress_image(data: list[int], stride: int, height: int, unit: int) -> list[int]:
+    """Compress the rows of an image, each taking stride bytes."""
+    out: list[int] = []
+    for y in range(height):
+        out += encode_row(bytes(data[y * stride : (y + 1) * stride]), unit)
+    return out
+
+
+def compress_animation(
+    data: list[int], stride: int, height: int, frames: int, unit: int
+) -> list[int]:
+    """Compress the frames of an animation, each one image of stride * height bytes."""
+    frame_size = stride * height
+    table: list[int] = []
+    out: list[int] = []
+    table_size = frames * 4
+    for frame in range(frames):
+        offset = table_size + len(out)
+        key_frame = frame % KEY_FRAME_INTERVAL == 0
+        if key_frame:
+            offset |= KEY_FRAME_FLAG
+        table += list(offset.to_bytes(4, "little"))
+
+        start = frame * frame_size
+        for y in range(height):
+            row_start = start + y * stride
+            row = bytes(data[row_start : row_start + stride])
+            previous = None
+            if not key_frame:
+                previous_start = row_start - frame_size
+                previous = bytes(data[previous_start : previous_start + stride])
+            out += encode_row(row, unit, previous)
+    return table + out
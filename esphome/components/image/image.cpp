@@ -1,98 +1,178 @@
 #include "image.h"
 
+#include <algorithm>
+#include <memory>
+
 #include "esphome/core/hal.h"
 
 namespace esphome {
 namespace image {
 
-void Image::draw(int x, int y, display::Display *display, Color color_on, Color color_off) {
-  switch (type_) {
-    case IMAGE_TYPE_BINARY: {
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          if (this->get_binary_pixel_(img_x, img_y)) {
-            display->draw_pixel_at(x + img_x, y + img_y, color_on);
-          } else if (!this->transparent_) {
-            display->draw_pixel_at(x + img_x, y + img_y, color_off);
-          }
-        }
-      }
-      break;
-    }
-    case IMAGE_TYPE_GRAYSCALE:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          auto color = this->get_grayscale_pixel_(img_x, img_y);
-          if (color.w >= 0x80) {
-            display->draw_pixel_at(x + img_x, y + img_y, color);
-          }
-        }
-      }
-      break;
-    case IMAGE_TYPE_RGB565:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          auto color = this->get_rgb565_pixel_(img_x, img_y);
-          if (color.w >= 0x80) {
-            display->draw_pixel_at(x + img_x, y + img_y, color);
-          }
-        }
+/// Number of pixels decoded at once by Image::draw().
+static const uint8_t IMAGE_DRAW_CHUNK_SIZE = 64;
+
+static const uint8_t RUN_KIND_MASK = 0xC0;
+static const uint8_t RUN_LENGTH_MASK = 0x3F;
+static const uint8_t RUN_LITERAL = 0x00;
+static const uint8_t RUN_REPEAT = 0x40;
+
+void HOT RowDecoder::decode_row(uint8_t *row) {
+  uint16_t unit = 0;
+  while (unit < this->row_units_) {
+    const uint8_t header = progmem_read_byte(this->pos_++);
+    // Don't let a corrupt run write past the end of the row
+    const uint16_t count = std::min<uint16_t>((header & RUN_LENGTH_MASK) + 1, this->row_units_ - unit);
+    const uint8_t kind = header & RUN_KIND_MASK;
+    if (kind == RUN_LITERAL) {
+      const size_t bytes = count * this->unit_size_;
+      if (row != nullptr) {
+        uint8_t *out = row + unit * this->unit_size_;
+        for (size_t i = 0; i < bytes; i++)
+          out[i] = progmem_read_byte(this->pos_ + i);
       }
-      break;
-    case IMAGE_TYPE_RGB24:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          auto color = this->get_rgb24_pixel_(img_x, img_y);
-          if (color.w >= 0x80) {
-            display->draw_pixel_at(x + img_x, y + img_y, color);
-          }
+      this->pos_ += bytes;
+    } else if (kind == RUN_REPEAT) {
+      if (row != nullptr) {
+        uint8_t value[4];
+        for (uint8_t i = 0; i < this->unit_size_; i++)
+          value[i] = progmem_read_byte(this->pos_ + i);
+        uint8_t *out = row + unit * this->unit_size_;
+        for (uint16_t n = 0; n < count; n++) {
+          for (uint8_t i = 0; i < this->unit_size_; i++)
+            *out++ = value[i];
         }
       }
-      break;
-    case IMAGE_TYPE_RGBA:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          auto color = this->get_rgba_pixel_(img_x, img_y);
-          if (color.w >= 0x80) {
-            display->draw_pixel_at(x + img_x, y + img_y, color);
-          }
-        }
+      this->pos_ += this->unit_size_;
+    }
+    // Unchanged units are left as they are
+    unit += count;
+  }
+}
+
+void Image::draw(int x, int y, display::Display *display, Color color_on, Color color_off) {
+  const int stride = image_type_to_width_stride(this->width_, this->type_);
+  if (!this->compressed_) {
+    for (int img_y = 0; img_y < this->height_; img_y++)
+      this->draw_row_(x, y + img_y, this->data_start_ + img_y * stride, display, color_on, color_off);
+    return;
+  }
+
+  // Decode one row at a time straight into the drawing path
+  RowDecoder decoders[MAX_ROW_DECODERS];
+  const size_t count = this->get_row_decoders_(decoders);
+  if (count == 0)
+    return;
+  if (this->row_cursor_ != nullptr)
+    this->row_cursor_->key = nullptr;
+  this->row_buffer_.resize(stride);
+  for (int img_y = 0; img_y < this->height_; img_y++) {
+    for (size_t i = 0; i < count; i++)
+      decoders[i].decode_row(this->row_buffer_.data());
+    this->draw_row_(x, y + img_y, this->row_buffer_.data(), display, color_on, color_off);
+  }
+}
+void Image::draw_row_(int x, int y, const uint8_t *row, display::Display *display, Color color_on,
+                      Color color_off) {
+  if (this->type_ == IMAGE_TYPE_BINARY) {
+    // Draw runs of equal pixels as spans
+    int img_x = 0;
+    while (img_x < this->width_) {
+      const bool on = this->get_binary_pixel_(row, img_x);
+      int run_end = img_x + 1;
+      while (run_end < this->width_ && this->get_binary_pixel_(row, run_end) == on)
+        run_end++;
+      if (on) {
+        display->fill_span(x + img_x, y, run_end - img_x, color_on);
+      } else if (!this->transparent_) {
+        display->fill_span(x + img_x, y, run_end - img_x, color_off);
       }
-      break;
+      img_x = run_end;
+    }
+    return;
+  }
+
+  // Decode the row in chunks, so the display can clip and rotate them at once
+  Color colors[IMAGE_DRAW_CHUNK_SIZE];
+  for (int img_x = 0; img_x < this->width_; img_x += IMAGE_DRAW_CHUNK_SIZE) {
+    const int len = std::min(this->width_ - img_x, (int) IMAGE_DRAW_CHUNK_SIZE);
+    for (int i = 0; i < len; i++)
+      colors[i] = this->get_row_pixel_(row, img_x + i, color_on, color_off);
+    display->blit_rect(x + img_x, y, len, 1, colors);
   }
 }
+size_t Image::get_row_decoders_(RowDecoder *decoders) const {
+  decoders[0] = this->make_row_decoder_(this->data_start_);
+  return 1;
+}
+RowDecoder Image::make_row_decoder_(const uint8_t *data) const {
+  const int bpp = image_type_to_bpp(this->type_);
+  // Binary images are encoded byte by byte, the others pixel by pixel
+  const uint8_t unit_size = bpp < 8 ? 1 : bpp / 8;
+  return RowDecoder(data, unit_size, image_type_to_width_stride(this->width_, this->type_) / unit_size);
+}
 Color Image::get_pixel(int x, int y, Color color_on, Color color_off) const {
   if (x < 0 || x >= this->width_ || y < 0 || y >= this->height_)
     return color_off;
+  const int stride = image_type_to_width_stride(this->width_, this->type_);
+  if (!this->compressed_)
+    return this->get_row_pixel_(this->data_start_ + y * stride, x, color_on, color_off);
+
+  if (!this->seek_row_(y))
+    return color_off;
+  return this->get_row_pixel_(this->row_buffer_.data(), x, color_on, color_off);
+}
+bool Image::seek_row_(int y) const {
+  RowDecoder decoders[MAX_ROW_DECODERS];
+  const size_t count = this->get_row_decoders_(decoders);
+  if (count == 0)
+    return false;
+  if (this->row_cursor_ == nullptr)
+    this->row_cursor_ = make_unique<RowCursor>();
+  RowCursor &cursor = *this->row_cursor_;
+  const uint8_t *key = decoders[count - 1].get_position();
+  if (cursor.key != key || cursor.count != count || cursor.y > y) {
+    // Rows can only be decoded in order, start over from the first one
+    std::copy(decoders, decoders + count, cursor.decoders);
+    cursor.count = count;
+    cursor.key = key;
+    cursor.y = -1;
+    this->row_buffer_.resize(image_type_to_width_stride(this->width_, this->type_));
+  }
+  while (cursor.y < y) {
+    cursor.y++;
+    for (size_t i = 0; i < count; i++)
+      cursor.decoders[i].decode_row(cursor.y == y ? this->row_buffer_.data() : nullptr);
+  }
+  return true;
+}
+Color Image::get_row_pixel_(const uint8_t *row, int x, Color color_on, Color color_off) const {
   switch (this->type_) {
     case IMAGE_TYPE_BINARY:
-      return this->get_binary_pixel_(x, y) ? color_on : color_off;
+      return this->get_binary_pixel_(row, x) ? color_on : color_off;
     case IMAGE_TYPE_GRAYSCALE:
-      return this->get_grayscale_pixel_(x, y);
+      return this->get_grayscale_pixel_(row, x);
     case IMAGE_TYPE_RGB565:
-      return this->get_rgb565_pixel_(x, y);
+      return this->get_rgb565_pixel_(row, x);
     case IMAGE_TYPE_RGB24:
-      return this->get_rgb24_pixel_(x, y);
+      return this->get_rgb24_pixel_(row, x);
     case IMAGE_TYPE_RGBA:
-      return this->get_rgba_pixel_(x, y);
+      return this->get_rgba_pixel_(row, x);
     default:
       return color_off;
   }
 }
-bool Image::get_binary_pixel_(int x, int y) const {
-  const uint32_t width_8 = ((this->width_ + 7u) / 8u) * 8u;
-  const uint32_t pos = x + y * width_8;
-  return progmem_read_byte(this->data_start_ + (pos / 8u)) & (0x80 >> (pos % 8u));
+bool Image::get_binary_pixel_(const uint8_t *row, int x) const {
+  return progmem_read_byte(row + (x / 8u)) & (0x80 >> (x % 8u));
 }
-Color Image::get_rgba_pixel_(int x, int y) const {
-  const uint32_t pos = (x + y * this->width_) * 4;
-  return Color(progmem_read_byte(this->data_start_ + pos + 0), progmem_read_byte(this->data_start_ + pos + 1),
-               progmem_read_byte(this->data_start_ + pos + 2), progmem_read_byte(this->data_start_ + pos + 3));
+Color Image::get_rgba_pixel_(const uint8_t *row, int x) const {
+  const uint32_t pos = x * 4;
+  return Color(progmem_read_byte(row + pos + 0), progmem_read_byte(row + pos + 1), progmem_read_byte(row + pos + 2),
+               progmem_read_byte(row + pos + 3));
 }
-Color Image::get_rgb24_pixel_(int x, int y) const {
-  const uint32_t pos = (x + y * this->width_) * 3;
-  Color color = Color(progmem_read_byte(this->data_start_ + pos + 0), progmem_read_byte(this->data_start_ + pos + 1),
-                      progmem_read_byte(this->data_start_ + pos + 2));
+Color Image::get_rgb24_pixel_(const uint8_t *row, int x) const {
+  const uint32_t pos = x * 3;
+  Color color = Color(progmem_read_byte(row + pos + 0), progmem_read_byte(row + pos + 1),
+                      progmem_read_byte(row + pos + 2));
   if (color.b == 1 && color.r == 0 && color.g == 0 && transparent_) {
     // (0, 0, 1) has been defined as transparent color for non-alpha images.
     // putting blue == 1 as a first condition for performance reasons (least likely value to short-cut the if)
@@ -102,10 +182,9 @@ Color Image::get_rgb24_pixel_(int x, int y) const {
   }
   return color;
 }
-Color Image::get_rgb565_pixel_(int x, int y) const {
-  const uint32_t pos = (x + y * this->width_) * 2;
-  uint16_t rgb565 =
-      progmem_read_byte(this->data_start_ + pos + 0) << 8 | progmem_read_byte(this->data_start_ + pos + 1);
+Color Image::get_rgb565_pixel_(const uint8_t *row, int x) const {
+  const uint32_t pos = x * 2;
+  uint16_t rgb565 = progmem_read_byte(row + pos + 0) << 8 | progmem_read_byte(row + pos + 1);
   auto r = (rgb565 & 0xF800) >> 11;
   auto g = (rgb565 & 0x07E0) >> 5;
   auto b = rgb565 & 0x001F;
@@ -118,9 +197,8 @@ Color Image::get_rgb565_pixel_(int x, int y) const {
   }
   return color;
 }
-Color Image::get_grayscale_pixel_(int x, int y) const {
-  const uint32_t pos = (x + y * this->width_);
-  const uint8_t gray = progmem_read_byte(this->data_start_ + pos);
+Color Image::get_grayscale_pixel_(const uint8_t *row, int x) const {
+  const uint8_t gray = progmem_read_byte(row + x);
   uint8_t alpha = (gray == 1 && transparent_) ? 0 : 0xFF;
   return Color(gray, gray, gray, alpha);
 }
@@ -1,4 +1,7 @@
 #pragma once
+#include <memory>
+#include <vector>
+
 #include "esphome/core/color.h"
 #include "esphome/components/display/display_buffer.h"
 
@@ -31,6 +34,34 @@ inline int image_type_to_bpp(ImageType type) {
 
 inline int image_type_to_width_stride(int width, ImageType type) { return (width * image_type_to_bpp(type) + 7u) / 8u; }
 
+/// Maximum number of frames whose rows are combined to decode a compressed animation frame.
+static const uint8_t MAX_ROW_DECODERS = 16;
+
+/** Decodes the rows of a compressed image one after the other.
+ *
+ * Each row is a sequence of runs of units, where a unit is a pixel, or a byte of pixels for binary images. A run
+ * starts with a header byte, whose top two bits select the kind of run and whose low six bits are its length - 1:
+ * - 0b00: that many units follow.
+ * - 0b01: one unit follows, which is repeated.
+ * - 0b10: the units are unchanged from the previous frame of an animation.
+ */
+class RowDecoder {
+ public:
+  RowDecoder() = default;
+  RowDecoder(const uint8_t *data, uint8_t unit_size, uint16_t row_units)
+      : pos_(data), unit_size_(unit_size), row_units_(row_units) {}
+
+  /// Decode the next row into row, which keeps its content where the units are unchanged. Skips the row if nullptr.
+  void decode_row(uint8_t *row);
+  /// Position of the next row in the compressed data.
+  const uint8_t *get_position() const { return this->pos_; }
+
+ protected:
+  const uint8_t *pos_{nullptr};
+  uint8_t unit_size_{1};
+  uint16_t row_units_{0};
+};
+
 class Image : public display::BaseImage {
  public:
   Image(const uint8_t *data_start, int width, int height, ImageType type);
@@ -45,18 +76,49 @@ class Image : public display::BaseImage {
   void set_transparency(bool transparent) { transparent_ = transparent; }
   bool has_transparency() const { return transparent_; }
 
+  /** Set whether the data is compressed, as decoded by RowDecoder.
+   *
+   * Compressed images are drawn row by row. get_pixel() keeps the last row it decoded, so reading pixels along a row
+   * or from the next row is cheap, but going back up decodes the image from its first row again. get_data_start()
+   * doesn't point to raw pixels.
+   */
+  void set_compressed(bool compressed) { this->compressed_ = compressed; }
+  bool is_compressed() const { return this->compressed_; }
+
  protected:
-  bool get_binary_pixel_(int x, int y) const;
-  Color get_rgb24_pixel_(int x, int y) const;
-  Color get_rgba_pixel_(int x, int y) const;
-  Color get_rgb565_pixel_(int x, int y) const;
-  Color get_grayscale_pixel_(int x, int y) const;
+  /// Set up the decoders whose rows, applied in order, give the rows of the image. Returns how many there are.
+  virtual size_t get_row_decoders_(RowDecoder *decoders) const;
+  RowDecoder make_row_decoder_(const uint8_t *data) const;
+  /// Decode rows of a compressed image until row y is in row_buffer_, returns false if it can't be decoded.
+  bool seek_row_(int y) const;
+  void draw_row_(int x, int y, const uint8_t *row, display::Display *display, Color color_on, Color color_off);
+  Color get_row_pixel_(const uint8_t *row, int x, Color color_on, Color color_off) const;
+
+  bool get_binary_pixel_(const uint8_t *row, int x) const;
+  Color get_rgb24_pixel_(const uint8_t *row, int x) const;
+  Color get_rgba_pixel_(const uint8_t *row, int x) const;
+  Color get_rgb565_pixel_(const uint8_t *row, int x) const;
+  Color get_grayscale_pixel_(const uint8_t *row, int x) const;
 
   int width_;
   int height_;
   ImageType type_;
   const uint8_t *data_start_;
   bool transparent_;
+  bool compressed_{false};
+  /// The decoded row of a compressed image.
+  mutable std::vector<uint8_t> row_buffer_;
+
+  /// Decoders of get_pixel(), positioned after the row that is in row_buffer_.
+  struct RowCursor {
+    RowDecoder decoders[MAX_ROW_DECODERS];
+    size_t count{0};
+    /// Start of the last decoder, which identifies the frame of an animation. nullptr when row_buffer_ was reused.
+    const uint8_t *key{nullptr};
+    int y{-1};
+  };
+  /// Only allocated once get_pixel() is used on a compressed image.
+  mutable std::unique_ptr<RowCursor> row_cursor_;
 };
 
 }  // namespace image
@@ -0,0 +1,190 @@
+#include "json_writer.h"
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+namespace esphome {
+namespace json {
+
+JsonWriter::JsonWriter(char *buffer, size_t size) : buffer_(buffer), capacity_(size) {
+  if (size != 0)
+    buffer[0] = '\0';
+}
+
+void JsonWriter::begin_object() {
+  this->separator_();
+  this->write_('{');
+  if (this->depth_ < MAX_DEPTH)
+    this->has_members_ &= ~(1UL << this->depth_);
+  this->depth_++;
+}
+void JsonWriter::end_object() {
+  this->write_('}');
+  this->depth_--;
+}
+void JsonWriter::begin_array() {
+  this->separator_();
+  this->write_('[');
+  if (this->depth_ < MAX_DEPTH)
+    this->has_members_ &= ~(1UL << this->depth_);
+  this->depth_++;
+}
+void JsonWriter::end_array() {
+  this->write_(']');
+  this->depth_--;
+}
+
+void JsonWriter::key(const char *key) {
+  this->separator_();
+  this->write_string_(key, strlen(key));
+  this->write_(':');
+  this->after_key_ = true;
+}
+
+void JsonWriter::value(const char *value) {
+  if (value == nullptr) {
+    this->null_value();
+    return;
+  }
+  this->value_(value, strlen(value));
+}
+void JsonWriter::value(bool value) {
+  this->separator_();
+  if (value) {
+    this->write_("true", 4);
+  } else {
+    this->write_("false", 5);
+  }
+}
+void JsonWriter::null_value() {
+  this->separator_();
+  this->write_("null", 4);
+}
+
+void JsonWriter::separator_() {
+  if (this->after_key_) {
+    this->after_key_ = false;
+    return;
+  }
+  if (this->depth_ == 0)
+    return;
+  // Nesting deeper than MAX_DEPTH isn't supported, all elements get a comma there
+  uint8_t level = this->depth_ - 1;
+  if (level >= MAX_DEPTH || (this->has_members_ & (1UL << level))) {
+    this->write_(',');
+  } else {
+    this->has_members_ |= 1UL << level;
+  }
+}
+
+void JsonWriter::value_(const char *value, size_t len) {
+  this->separator_();
+  this->write_string_(value, len);
+}
+
+void JsonWriter::value_int_(int64_t value) {
+  if (value >= 0) {
+    this->value_uint_(value);
+    return;
+  }
+  this->separator_();
+  this->write_('-');
+  // Negate in unsigned arithmetic so that INT64_MIN doesn't overflow
+  uint64_t magnitude = ~static_cast<uint64_t>(value) + 1;
+  char buf[20];
+  char *pos = buf + sizeof(buf);
+  do {
+    *--pos = static_cast<char>('0' + magnitude % 10);
+    magnitude /= 10;
+  } while (magnitude != 0);
+  this->write_(pos, buf + sizeof(buf) - pos);
+}
+
+void JsonWriter::value_uint_(uint64_t value) {
+  this->separator_();
+  char buf[20];
+  char *pos = buf + sizeof(buf);
+  do {
+    *--pos = static_cast<char>('0' + value % 10);
+    value /= 10;
+  } while (value != 0);
+  this->write_(pos, buf + sizeof(buf) - pos);
+}
+
+void JsonWriter::value_float_(double value, int precision) {
+  if (!std::isfinite(value)) {
+    this->null_value();
+    return;
+  }
+  this->separator_();
+  char buf[32];
+  int len = snprintf(buf, sizeof(buf), "%.*g", precision, value);
+  this->write_(buf, len);
+}
+
+void JsonWriter::write_string_(const char *value, size_t len) {
+  this->write_('"');
+  const char *end = value + len;
+  const char *run = value;
+  for (const char *pos = value; pos != end; pos++) {
+    auto c = static_cast<uint8_t>(*pos);
+    if (c >= 0x20 && c != '"' && c != '\\')
+      continue;
+    // Copy the characters that need no escaping in one go
+    this->write_(run, pos - run);
+    run = pos + 1;
+    char escape[7] = {'\\', static_cast<char>(c), 0};
+    size_t escape_len = 2;
+    switch (c) {
+      case '"':
+      case '\\':
+        break;
+      case '\b':
+        escape[1] = 'b';
+        break;
+      case '\f':
+        escape[1] = 'f';
+        break;
+      case '\n':
+        escape[1] = 'n';
+        break;
+      case '\r':
+        escape[1] = 'r';
+        break;
+      case '\t':
+        escape[1] = 't';
+        break;
+      default:
+        escape_len = snprintf(escape, sizeof(escape), "\\u%04x", c);
+        break;
+    }
+    this->write_(escape, escape_len);
+  }
+  this->write_(run, end - run);
+  this->write_('"');
+}
+
+void JsonWriter::write_(const char *data, size_t len) {
+  if (this->string_ != nullptr) {
+    this->string_->append(data, len);
+    return;
+  }
+  if (this->overflowed_)
+    return;
+  if (this->capacity_ == 0) {
+    this->overflowed_ = len != 0;
+    return;
+  }
+  // Keep room for the null terminator
+  size_t room = this->capacity_ - 1 - this->size_;
+  if (len > room) {
+    len = room;
+    this->overflowed_ = true;
+  }
+  memcpy(this->buffer_ + this->size_, data, len);
+  this->size_ += len;
+  this->buffer_[this->size_] = '\0';
+}
+
+}  // namespace json
+}  // namespace esphome
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+#include "esphome/core/helpers.h"
+#include "esphome/core/string_ref.h"
+
+namespace esphome {
+namespace json {
+
+/** Writes a JSON document straight to its output while it is being built.
+ *
+ * Unlike build_json(), no intermediate document is allocated, so there is no need to guess its size and retry the
+ * builder when it overflows. The writer only keeps one bit per nesting level, up to MAX_DEPTH levels.
+ *
+ * Members and array elements must be written in their final order, a key can't be set twice:
+ *
+ * ```cpp
+ * std::string output;
+ * json::JsonWriter writer(output);
+ * writer.begin_object();
+ * writer.add("id", "sensor-temperature");
+ * writer.begin_array("values");
+ * writer.value(1);
+ * writer.end_array();
+ * writer.end_object();
+ * ```
+ */
+class JsonWriter {
+ public:
+  static const uint8_t MAX_DEPTH = 32;
+
+  /// Append the JSON to a string, which the caller can reserve() or reuse between documents.
+  explicit JsonWriter(std::string &output) : string_(&output) {}
+  /// Write the JSON to a fixed size buffer, which is always null terminated. Check overflowed() when done.
+  JsonWriter(char *buffer, size_t size);
+
+  void begin_object();
+  void begin_object(const char *key) {
+    this->key(key);
+    this->begin_object();
+  }
+  void end_object();
+  void begin_array();
+  void begin_array(const char *key) {
+    this->key(key);
+    this->begin_array();
+  }
+  void end_array();
+
+  /// Start an object member, the next value is its value.
+  void key(const char *key);
+
+  void value(const char *value);
+  void value(const std::string &value) { this->value_(value.data(), value.size()); }
+  void value(const StringRef &value) { this->value_(value.c_str(), value.size()); }
+  void value(bool value);
+  template<typename T, enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value, int> = 0>
+  void value(T value) {
+    if (std::is_signed<T>::value) {
+      this->value_int_(static_cast<int64_t>(value));
+    } else {
+      this->value_uint_(static_cast<uint64_t>(value));
+    }
+  }
+  template<typename T, enable_if_t<std::is_enum<T>::value, int> = 0> void value(T value) {
+    this->value(static_cast<typename std::underlying_type<T>::type>(value));
+  }
+  /// Floats are written with just enough digits to read them back exactly, NaN and infinity as null.
+  void value(float value) { this->value_float_(value, 9); }
+  void value(double value) { this->value_float_(value, 17); }
+  void null_value();
+
+  /// Write an object member.
+  template<typename T> void add(const char *key, const T &value) {
+    this->key(key);
+    this->value(value);
+  }
+
+  /// Number of bytes written to the fixed size buffer.
+  size_t size() const { return this->size_; }
+  /// Whether the fixed size buffer was too small, the output is truncated then.
+  bool overflowed() const { return this->overflowed_; }
+
+ protected:
+  void separator_();
+  void value_(const char *value, size_t len);
+  void value_int_(int64_t value);
+  void value_uint_(uint64_t value);
+  void value_float_(double value, int precision);
+  void write_string_(const char *value, size_t len);
+  void write_(const char *data, size_t len);
+  void write_(char c) { this->write_(&c, 1); }
+
+  std::string *string_{nullptr};
+  char *buffer_{nullptr};
+  size_t capacity_{0};
+  size_t size_{0};
+  /// One bit per nesting level, set when the level already has a member or element.
+  uint32_t has_members_{0};
+  uint8_t depth_{0};
+  bool after_key_{false};
+  bool overflowed_{false};
+};
+
+}  // namespace json
+}  // namespace esphome
@@ -99,8 +99,15 @@ optional<LightColorValues> AddressableLightTransformer::apply() {
     uint8_t inv_alpha8 = 255 - alpha8;
     Color add = this->target_color_ * alpha8;
 
-    for (auto led : this->light_)
-      led.set(add + led.get() * inv_alpha8);
+    if (this->light_.size() >= ESP_COLOR_LUT_MIN_SIZE) {
+      // The blend is per channel, so for long strips it's cheaper to compute it once for every possible value.
+      ESPColorLUT &lut = get_scratch_lut();
+      this->light_.correction_.build_lut(lut, [add, inv_alpha8](Color c) { return add + c * inv_alpha8; });
+      this->light_.all().apply_lut(lut);
+    } else {
+      for (auto led : this->light_)
+        led.set(add + led.get() * inv_alpha8);
+    }
   }
 
   this->last_transition_progress_ = smoothed_progress;
@@ -5,6 +5,11 @@
 namespace esphome {
 namespace light {
 
+ESPColorLUT &get_scratch_lut() {
+  static ESPColorLUT *lut = new ESPColorLUT();  // NOLINT
+  return *lut;
+}
+
 void ESPColorCorrection::calculate_gamma_table(float gamma) {
   for (uint16_t i = 0; i < 256; i++) {
     // corrected = val ^ gamma
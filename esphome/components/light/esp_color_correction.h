@@ -5,6 +5,27 @@
 namespace esphome {
 namespace light {
 
+/// Per-channel lookup table mapping raw (color corrected) LED values to new raw values.
+struct ESPColorLUT {
+  uint8_t red[256];
+  uint8_t green[256];
+  uint8_t blue[256];
+  uint8_t white[256];
+
+  inline Color apply(Color raw) const ESPHOME_ALWAYS_INLINE {
+    return Color(this->red[raw.r], this->green[raw.g], this->blue[raw.b], this->white[raw.w]);
+  }
+};
+
+/// Building an ESPColorLUT costs about as much as transforming this many LEDs one at a time.
+static const int32_t ESP_COLOR_LUT_MIN_SIZE = 256;
+
+/** A lookup table shared by all lights for building and applying a table right away, from the main loop only.
+ *
+ * It's allocated on first use, so only configurations with long strips pay for it, and it doesn't take 1 KiB of stack.
+ */
+ESPColorLUT &get_scratch_lut();
+
 class ESPColorCorrection {
  public:
   ESPColorCorrection() : max_brightness_(255, 255, 255, 255) {}
@@ -65,6 +86,21 @@ class ESPColorCorrection {
     uint16_t res = ((uncorrected / this->max_brightness_.white) * 255UL) / this->local_brightness_;
     return (uint8_t) std::min(res, uint16_t(255));
   }
+  /** Fill a lookup table that applies `func` to the uncorrected color of an LED, working on raw values directly.
+   *
+   * `func` must treat each channel independently (like blending, fading, lightening or darkening), so that the result
+   * for a channel only depends on that channel's input.
+   */
+  template<typename F> void build_lut(ESPColorLUT &lut, F &&func) const {
+    for (uint16_t i = 0; i < 256; i++) {
+      Color uncorrected = this->color_uncorrect(Color(i, i, i, i));
+      Color corrected = this->color_correct(func(uncorrected));
+      lut.red[i] = corrected.r;
+      lut.green[i] = corrected.g;
+      lut.blue[i] = corrected.b;
+      lut.white[i] = corrected.w;
+    }
+  }
 
  protected:
   uint8_t gamma_table_[256];
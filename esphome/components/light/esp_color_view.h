@@ -67,6 +67,14 @@ class ESPColorView : public ESPColorSettable {
       return;
     *this->effect_data_ = effect_data;
   }
+  /// Set the raw values, which must already be color corrected.
+  void set_raw(const Color &raw) {
+    *this->red_ = raw.r;
+    *this->green_ = raw.g;
+    *this->blue_ = raw.b;
+    if (this->white_ != nullptr)
+      *this->white_ = raw.w;
+  }
   void fade_to_white(uint8_t amnt) override { this->set(this->get().fade_to_white(amnt)); }
   void fade_to_black(uint8_t amnt) override { this->set(this->get().fade_to_black(amnt)); }
   void lighten(uint8_t delta) override { this->set(this->get().lighten(delta)); }
@@ -88,6 +96,9 @@ class ESPColorView : public ESPColorSettable {
       return 0;
     return *this->white_;
   }
+  Color get_raw() const {
+    return Color(this->get_red_raw(), this->get_green_raw(), this->get_blue_raw(), this->get_white_raw());
+  }
   uint8_t get_effect_data() const {
     if (this->effect_data_ == nullptr)
       return 0;
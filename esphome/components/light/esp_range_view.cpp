@@ -18,8 +18,10 @@ ESPRangeIterator ESPRangeView::begin() { return {*this, this->begin_}; }
 ESPRangeIterator ESPRangeView::end() { return {*this, this->end_}; }
 
 void ESPRangeView::set(const Color &color) {
+  // Every LED gets the same value, so only correct it once
+  Color raw = this->parent_->get_correction().color_correct(color);
   for (int32_t i = this->begin_; i < this->end_; i++) {
-    (*this->parent_)[i] = color;
+    (*this->parent_)[i].set_raw(raw);
   }
 }
 
@@ -45,21 +47,49 @@ void ESPRangeView::set_effect_data(uint8_t effect_data) {
 }
 
 void ESPRangeView::fade_to_white(uint8_t amnt) {
+  if (this->size() >= ESP_COLOR_LUT_MIN_SIZE) {
+    ESPColorLUT &lut = get_scratch_lut();
+    this->parent_->get_correction().build_lut(lut, [amnt](Color c) { return c.fade_to_white(amnt); });
+    this->apply_lut(lut);
+    return;
+  }
   for (auto c : *this)
     c.fade_to_white(amnt);
 }
 void ESPRangeView::fade_to_black(uint8_t amnt) {
+  if (this->size() >= ESP_COLOR_LUT_MIN_SIZE) {
+    ESPColorLUT &lut = get_scratch_lut();
+    this->parent_->get_correction().build_lut(lut, [amnt](Color c) { return c.fade_to_black(amnt); });
+    this->apply_lut(lut);
+    return;
+  }
   for (auto c : *this)
     c.fade_to_black(amnt);
 }
 void ESPRangeView::lighten(uint8_t delta) {
+  if (this->size() >= ESP_COLOR_LUT_MIN_SIZE) {
+    ESPColorLUT &lut = get_scratch_lut();
+    this->parent_->get_correction().build_lut(lut, [delta](Color c) { return c.lighten(delta); });
+    this->apply_lut(lut);
+    return;
+  }
   for (auto c : *this)
     c.lighten(delta);
 }
 void ESPRangeView::darken(uint8_t delta) {
+  if (this->size() >= ESP_COLOR_LUT_MIN_SIZE) {
+    ESPColorLUT &lut = get_scratch_lut();
+    this->parent_->get_correction().build_lut(lut, [delta](Color c) { return c.darken(delta); });
+    this->apply_lut(lut);
+    return;
+  }
   for (auto c : *this)
     c.darken(delta);
 }
+void ESPRangeView::apply_lut(const ESPColorLUT &lut) {
+  for (auto c : *this)
+    c.set_raw(lut.apply(c.get_raw()));
+}
 ESPRangeView &ESPRangeView::operator=(const ESPRangeView &rhs) {  // NOLINT
   // If size doesn't match, error (todo warning)
   if (rhs.size() != this->size())
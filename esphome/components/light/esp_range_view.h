@@ -37,6 +37,8 @@ class ESPRangeView : public ESPColorSettable {
   void fade_to_black(uint8_t amnt) override;
   void lighten(uint8_t delta) override;
   void darken(uint8_t delta) override;
+  /// Replace the raw value of every LED in the range with its entry in `lut`.
+  void apply_lut(const ESPColorLUT &lut);
 
   ESPRangeView &operator=(const Color &rhs) {
     this->set(rhs);
@@ -5,6 +5,7 @@
 #ifdef USE_JSON
 
 #include "esphome/components/json/json_util.h"
+#include "esphome/components/json/json_writer.h"
 #include "light_call.h"
 #include "light_state.h"
 
@@ -13,8 +14,8 @@ namespace light {
 
 class LightJSONSchema {
  public:
-  /// Dump the state of a light as JSON.
-  static void dump_json(LightState &state, JsonObject root);
+  /// Dump the state of a light as members of the current JSON object.
+  static void dump_json(LightState &state, json::JsonWriter &root);
   /// Parse the JSON state of a light to a LightCall.
   static void parse_json(LightState &state, LightCall &call, JsonObject root);
 
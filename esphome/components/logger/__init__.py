@@ -170,6 +170,7 @@ LoggerMessageTrigger = logger_ns.class_(
 )
 
 CONF_ESP8266_STORE_LOG_STRINGS_IN_FLASH = "esp8266_store_log_strings_in_flash"
+CONF_DEFERRED_BUFFER_SIZE = "deferred_buffer_size"
 CONFIG_SCHEMA = cv.All(
     cv.Schema(
         {
@@ -177,6 +178,9 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_BAUD_RATE, default=115200): cv.positive_int,
             cv.Optional(CONF_TX_BUFFER_SIZE, default=512): cv.validate_bytes,
             cv.Optional(CONF_DEASSERT_RTS_DTR, default=False): cv.boolean,
+            cv.Optional(CONF_DEFERRED_BUFFER_SIZE): cv.All(
+                cv.validate_bytes, cv.int_range(min=512)
+            ),
             cv.SplitDefault(
                 CONF_HARDWARE_UART,
                 esp8266=UART0,
@@ -237,6 +241,13 @@ async def to_code(config):
     for tag, level in config[CONF_LOGS].items():
         cg.add(log.set_log_level(tag, LOG_LEVELS[level]))
 
+    if CONF_DEFERRED_BUFFER_SIZE in config:
+        cg.add_define("USE_LOGGER_DEFERRED")
+        if CORE.is_esp32:
+            # Messages from other FreeRTOS tasks are queued in the same buffer
+            cg.add_define("USE_LOGGER_DEFERRED_TASKS")
+        cg.add(log.set_deferred_buffer_size(config[CONF_DEFERRED_BUFFER_SIZE]))
+
     level = config[CONF_LEVEL]
     cg.add_define("USE_LOGGER")
     this_severity = LOG_LEVEL_SEVERITY.index(level)
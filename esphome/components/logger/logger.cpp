@@ -10,6 +10,9 @@ namespace logger {
 
 static const char *const TAG = "logger";
 
+/// Number of tags whose level is cached when there are per-tag log levels.
+static const size_t TAG_LEVEL_CACHE_SIZE = 32;
+
 static const char *const LOG_LEVEL_COLORS[] = {
     "",                                            // NONE
     ESPHOME_LOG_BOLD(ESPHOME_LOG_COLOR_RED),       // ERROR
@@ -32,6 +35,21 @@ static const char *const LOG_LEVEL_LETTERS[] = {
 };
 
 void Logger::write_header_(int level, const char *tag, int line) {
+  const char *thread_name = nullptr;
+#if defined(USE_ESP32) || defined(USE_LIBRETINY)
+  TaskHandle_t current_task = xTaskGetCurrentTaskHandle();
+  if (current_task != main_task_) {
+#if defined(USE_ESP32)
+    thread_name = pcTaskGetName(current_task);
+#elif defined(USE_LIBRETINY)
+    thread_name = pcTaskGetTaskName(current_task);
+#endif
+  }
+#endif
+  this->write_header_(level, tag, line, thread_name);
+}
+
+void Logger::write_header_(int level, const char *tag, int line, const char *thread_name) {
   if (level < 0)
     level = 0;
   if (level > 7)
@@ -39,29 +57,37 @@ void Logger::write_header_(int level, const char *tag, int line) {
 
   const char *color = LOG_LEVEL_COLORS[level];
   const char *letter = LOG_LEVEL_LETTERS[level];
-#if defined(USE_ESP32) || defined(USE_LIBRETINY)
-  TaskHandle_t current_task = xTaskGetCurrentTaskHandle();
-#else
-  void *current_task = nullptr;
-#endif
-  if (current_task == main_task_) {
+  if (thread_name == nullptr) {
     this->printf_to_buffer_("%s[%s][%s:%03u]: ", color, letter, tag, line);
   } else {
-    const char *thread_name = "";
-#if defined(USE_ESP32)
-    thread_name = pcTaskGetName(current_task);
-#elif defined(USE_LIBRETINY)
-    thread_name = pcTaskGetTaskName(current_task);
-#endif
     this->printf_to_buffer_("%s[%s][%s:%03u]%s[%s]%s: ", color, letter, tag, line,
                             ESPHOME_LOG_BOLD(ESPHOME_LOG_COLOR_RED), thread_name, color);
   }
 }
 
 void HOT Logger::log_vprintf_(int level, const char *tag, int line, const char *format, va_list args) {  // NOLINT
-  if (level > this->level_for(tag) || recursion_guard_)
+  if (level > this->min_tag_level_ && level > this->level_for(tag))
     return;
 
+#ifdef USE_LOGGER_DEFERRED_TASKS
+  // Other tasks never touch tx_buffer_, their messages are output by the main task
+  if (this->deferred_buffer_ != nullptr && !this->is_main_task_()) {
+    this->defer_vprintf_(level, tag, line, format, args, false);
+    return;
+  }
+#endif
+  if (recursion_guard_)
+    return;
+
+#ifdef USE_LOGGER_DEFERRED
+  if (this->deferred_buffer_ != nullptr && this->is_main_task_()) {
+    if (this->defer_vprintf_(level, tag, line, format, args, true))
+      return;
+    // Keep the order with messages that are already queued
+    this->flush_deferred_();
+  }
+#endif
+
   recursion_guard_ = true;
   this->reset_buffer_();
   this->write_header_(level, tag, line);
@@ -73,9 +99,14 @@ void HOT Logger::log_vprintf_(int level, const char *tag, int line, const char *
 #ifdef USE_STORE_LOG_STR_IN_FLASH
 void Logger::log_vprintf_(int level, const char *tag, int line, const __FlashStringHelper *format,
                           va_list args) {  // NOLINT
-  if (level > this->level_for(tag) || recursion_guard_)
+  if ((level > this->min_tag_level_ && level > this->level_for(tag)) || recursion_guard_)
     return;
 
+#ifdef USE_LOGGER_DEFERRED
+  if (this->deferred_buffer_ != nullptr && this->is_main_task_())
+    this->flush_deferred_();
+#endif
+
   recursion_guard_ = true;
   this->reset_buffer_();
   // copy format string
@@ -101,16 +132,520 @@ void Logger::log_vprintf_(int level, const char *tag, int line, const __FlashStr
 }
 #endif
 
+#ifdef USE_LOGGER_DEFERRED
+/** Header of a queued log message.
+ *
+ * It is followed by the name of the task that logged it, the tag and the format string, both null terminated, and
+ * the captured arguments. The tag and format are copied because they don't have to be static strings.
+ */
+struct DeferredLogRecord {
+  /// Size of the record including this header. It is stored last, so 0 means the record is still being written.
+  uint16_t size;
+  uint16_t line;
+  uint8_t level;
+  /// Size of the task name including its null terminator, 0 for messages from the main task.
+  uint8_t thread_name_size;
+};
+
+/// Record size that marks that the next record is at the start of the buffer.
+static const uint16_t DEFERRED_WRAP = 0xFFFF;
+/// Records start at multiples of this, so their size can be read and written atomically.
+static const size_t DEFERRED_ALIGNMENT = 4;
+/// Room for the tag, format string and captured arguments of a single message.
+static const size_t DEFERRED_MAX_DATA_SIZE = 256;
+static const size_t DEFERRED_MAX_THREAD_NAME_SIZE = 16;
+
+enum class DeferredArg : uint8_t {
+  NONE,
+  INT,
+  LONG,
+  LONG_LONG,
+  SIZE,
+  INTMAX,
+  PTRDIFF,
+  DOUBLE,
+  LONG_DOUBLE,
+  POINTER,
+  STRING,
+  UNSUPPORTED,
+};
+
+/// A single printf conversion specification.
+struct FormatSpec {
+  /// The '%' that starts the specification.
+  const char *begin;
+  /// One past the conversion character.
+  const char *end;
+  /// Number of '*' width and precision arguments that come before the value.
+  uint8_t stars;
+  bool precision;
+  DeferredArg arg;
+};
+
+static FormatSpec parse_format_spec(const char *p) {
+  FormatSpec spec{p, p + 1, 0, false, DeferredArg::UNSUPPORTED};
+  p++;
+  if (*p == '%') {
+    spec.end = p + 1;
+    spec.arg = DeferredArg::NONE;
+    return spec;
+  }
+  while (*p == '-' || *p == '+' || *p == ' ' || *p == '#' || *p == '0')
+    p++;
+  if (*p == '*') {
+    spec.stars++;
+    p++;
+  }
+  while (*p >= '0' && *p <= '9')
+    p++;
+  if (*p == '.') {
+    spec.precision = true;
+    p++;
+    if (*p == '*') {
+      spec.stars++;
+      p++;
+    }
+    while (*p >= '0' && *p <= '9')
+      p++;
+  }
+
+  // 'q' stands for "ll", "hh" behaves like 'h'
+  char length = 0;
+  switch (*p) {
+    case 'h':
+    case 'l':
+      length = *p++;
+      if (*p == length) {
+        length = length == 'l' ? 'q' : 'h';
+        p++;
+      }
+      break;
+    case 'z':
+    case 'j':
+    case 't':
+    case 'L':
+      length = *p++;
+      break;
+    default:
+      break;
+  }
+
+  char conversion = *p;
+  if (conversion == '\0') {
+    spec.end = p;
+    return spec;
+  }
+  spec.end = p + 1;
+  switch (conversion) {
+    case 'd':
+    case 'i':
+    case 'u':
+    case 'x':
+    case 'X':
+    case 'o':
+    case 'c':
+      if (conversion == 'c' && length != 0)
+        break;
+      switch (length) {
+        case 'l':
+          spec.arg = DeferredArg::LONG;
+          break;
+        case 'q':
+          spec.arg = DeferredArg::LONG_LONG;
+          break;
+        case 'z':
+          spec.arg = DeferredArg::SIZE;
+          break;
+        case 'j':
+          spec.arg = DeferredArg::INTMAX;
+          break;
+        case 't':
+          spec.arg = DeferredArg::PTRDIFF;
+          break;
+        case 'L':
+          break;
+        default:
+          spec.arg = DeferredArg::INT;
+          break;
+      }
+      break;
+    case 'f':
+    case 'F':
+    case 'e':
+    case 'E':
+    case 'g':
+    case 'G':
+    case 'a':
+    case 'A':
+      spec.arg = length == 'L' ? DeferredArg::LONG_DOUBLE : DeferredArg::DOUBLE;
+      break;
+    case 's':
+      // With a precision the string doesn't have to be null terminated, so it can't be copied up to its end
+      if (length == 0 && !spec.precision)
+        spec.arg = DeferredArg::STRING;
+      break;
+    case 'p':
+      spec.arg = DeferredArg::POINTER;
+      break;
+    default:
+      break;
+  }
+  return spec;
+}
+
+template<typename T> static bool put_deferred_arg(uint8_t *&out, const uint8_t *end, T value) {
+  if (static_cast<size_t>(end - out) < sizeof(T))
+    return false;
+  memcpy(out, &value, sizeof(T));
+  out += sizeof(T);
+  return true;
+}
+
+/// Copy the whole string including its null terminator, returns false if it doesn't fit.
+static bool put_deferred_string(uint8_t *&out, const uint8_t *end, const char *str) {
+  size_t len = strnlen(str, end - out);
+  if (len == static_cast<size_t>(end - out))
+    return false;
+  memcpy(out, str, len + 1);
+  out += len + 1;
+  return true;
+}
+
+template<typename T> static T get_deferred_arg(const uint8_t *&in, const uint8_t *end) {
+  T value{};
+  if (static_cast<size_t>(end - in) < sizeof(T))
+    return value;
+  memcpy(&value, in, sizeof(T));
+  in += sizeof(T);
+  return value;
+}
+
+void Logger::set_deferred_buffer_size(size_t size) {
+  size -= size % DEFERRED_ALIGNMENT;
+  this->deferred_buffer_ = new uint8_t[size]();  // NOLINT
+  this->deferred_size_ = size;
+}
+
+/** Copy the arguments referenced by the format string.
+ *
+ * Returns false if it uses a conversion that isn't supported or the arguments don't fit.
+ */
+static bool capture_deferred_args(const char *format, va_list args, uint8_t *&out, const uint8_t *end) {
+  bool ok = true;
+  va_list arg;
+  va_copy(arg, args);
+  for (const char *p = format; ok && *p != '\0'; p++) {
+    if (*p != '%')
+      continue;
+    FormatSpec spec = parse_format_spec(p);
+    p = spec.end - 1;
+    for (uint8_t i = 0; ok && i < spec.stars; i++)
+      ok = put_deferred_arg(out, end, va_arg(arg, int));
+    if (!ok)
+      break;
+    switch (spec.arg) {
+      case DeferredArg::NONE:
+        break;
+      case DeferredArg::INT:
+        ok = put_deferred_arg(out, end, va_arg(arg, int));
+        break;
+      case DeferredArg::LONG:
+        ok = put_deferred_arg(out, end, va_arg(arg, long));
+        break;
+      case DeferredArg::LONG_LONG:
+        ok = put_deferred_arg(out, end, va_arg(arg, long long));
+        break;
+      case DeferredArg::SIZE:
+        ok = put_deferred_arg(out, end, va_arg(arg, size_t));
+        break;
+      case DeferredArg::INTMAX:
+        ok = put_deferred_arg(out, end, va_arg(arg, intmax_t));
+        break;
+      case DeferredArg::PTRDIFF:
+        ok = put_deferred_arg(out, end, va_arg(arg, ptrdiff_t));
+        break;
+      case DeferredArg::DOUBLE:
+        ok = put_deferred_arg(out, end, va_arg(arg, double));
+        break;
+      case DeferredArg::LONG_DOUBLE:
+        ok = put_deferred_arg(out, end, va_arg(arg, long double));
+        break;
+      case DeferredArg::POINTER:
+        ok = put_deferred_arg(out, end, va_arg(arg, void *));
+        break;
+      case DeferredArg::STRING: {
+        // The string may not outlive the call, so copy it
+        const char *str = va_arg(arg, const char *);
+        ok = put_deferred_string(out, end, str == nullptr ? "(null)" : str);
+        break;
+      }
+      case DeferredArg::UNSUPPORTED:
+        ok = false;
+        break;
+    }
+  }
+  va_end(arg);
+  return ok;
+}
+
+bool HOT Logger::defer_vprintf_(int level, const char *tag, int line, const char *format, va_list args,
+                                bool main_task) {
+  // Capture everything on the stack first, so the record can be reserved with its exact size
+  uint8_t data[DEFERRED_MAX_THREAD_NAME_SIZE + DEFERRED_MAX_DATA_SIZE];
+  size_t thread_name_size = 0;
+#ifdef USE_LOGGER_DEFERRED_TASKS
+  if (!main_task) {
+    // The task may be gone by the time the message is output
+    const char *thread_name = pcTaskGetName(xTaskGetCurrentTaskHandle());
+    size_t len = strnlen(thread_name, DEFERRED_MAX_THREAD_NAME_SIZE - 1);
+    memcpy(data, thread_name, len);
+    data[len] = '\0';
+    thread_name_size = len + 1;
+  }
+#endif
+  const uint8_t *data_end = data + thread_name_size + DEFERRED_MAX_DATA_SIZE;
+  uint8_t *out = data + thread_name_size;
+  if (!put_deferred_string(out, data_end, tag))
+    return !main_task;
+  uint8_t *format_begin = out;
+  if (!put_deferred_string(out, data_end, format) || !capture_deferred_args(format, args, out, data_end)) {
+    if (main_task)
+      return false;
+    // Other tasks can't log synchronously, queue the formatted message instead. It is truncated if it doesn't fit.
+    out = format_begin;
+    if (!put_deferred_string(out, data_end, "%s") || out == data_end)
+      return true;
+    va_list arg;
+    va_copy(arg, args);
+    int ret = vsnprintf(reinterpret_cast<char *>(out), data_end - out, format, arg);
+    va_end(arg);
+    if (ret < 0)
+      return true;
+    out += std::min<size_t>(ret, data_end - out - 1) + 1;
+  }
+
+  size_t data_size = out - data;
+  size_t size = (sizeof(DeferredLogRecord) + data_size + DEFERRED_ALIGNMENT - 1) & ~(DEFERRED_ALIGNMENT - 1);
+  size_t offset = this->reserve_deferred_(size);
+  if (offset == this->deferred_size_ && main_task) {
+    this->flush_deferred_();
+    offset = this->reserve_deferred_(size);
+  }
+  if (offset == this->deferred_size_) {
+    if (main_task)
+      return false;
+#ifdef USE_LOGGER_DEFERRED_TASKS
+    this->deferred_dropped_[level].fetch_add(1, std::memory_order_relaxed);
+#endif
+    return true;
+  }
+
+  uint8_t *record = this->deferred_buffer_ + offset;
+  DeferredLogRecord header{0, static_cast<uint16_t>(line), static_cast<uint8_t>(level),
+                           static_cast<uint8_t>(thread_name_size)};
+  memcpy(record, &header, sizeof(header));
+  memcpy(record + sizeof(header), data, data_size);
+  // Publish the record to the main task
+  __atomic_store_n(reinterpret_cast<uint16_t *>(record), static_cast<uint16_t>(size), __ATOMIC_RELEASE);
+  return true;
+}
+
+size_t Logger::reserve_deferred_(size_t size) {
+  size_t head = this->deferred_head_.load(std::memory_order_relaxed);
+  size_t start;
+  while (true) {
+    size_t tail = this->deferred_tail_.load(std::memory_order_acquire);
+    if (head >= tail && this->deferred_size_ - head >= size) {
+      start = head;
+    } else if (head >= tail && tail > size) {
+      // Not enough room at the end, continue at the start of the buffer
+      start = 0;
+    } else if (head < tail && tail - head > size) {
+      start = head;
+    } else {
+      return this->deferred_size_;
+    }
+#ifdef USE_LOGGER_DEFERRED_TASKS
+    if (this->deferred_head_.compare_exchange_weak(head, start + size, std::memory_order_relaxed))
+      break;
+#else
+    this->deferred_head_.store(start + size, std::memory_order_relaxed);
+    break;
+#endif
+  }
+
+  if (start != head && head != this->deferred_size_) {
+    // Tell the main task to skip the rest of the buffer
+    __atomic_store_n(reinterpret_cast<uint16_t *>(this->deferred_buffer_ + head), DEFERRED_WRAP, __ATOMIC_RELEASE);
+  }
+  return start;
+}
+
+void Logger::flush_deferred_() {
+  size_t tail = this->deferred_tail_.load(std::memory_order_relaxed);
+  while (tail != this->deferred_head_.load(std::memory_order_acquire)) {
+    if (tail == this->deferred_size_) {
+      tail = 0;
+      this->deferred_tail_.store(tail, std::memory_order_release);
+      continue;
+    }
+    uint8_t *data = this->deferred_buffer_ + tail;
+    uint16_t size = __atomic_load_n(reinterpret_cast<uint16_t *>(data), __ATOMIC_ACQUIRE);
+    if (size == 0) {
+      // Still being written by another task, keep the order and output it next time
+      break;
+    }
+    if (size == DEFERRED_WRAP) {
+      memset(data, 0, sizeof(size));
+      tail = 0;
+      this->deferred_tail_.store(tail, std::memory_order_release);
+      continue;
+    }
+
+    DeferredLogRecord record;
+    memcpy(&record, data, sizeof(record));
+    const char *thread_name = nullptr;
+    if (record.thread_name_size != 0)
+      thread_name = reinterpret_cast<const char *>(data + sizeof(record));
+    const char *tag = reinterpret_cast<const char *>(data + sizeof(record) + record.thread_name_size);
+    const char *format = tag + strlen(tag) + 1;
+    const uint8_t *args = reinterpret_cast<const uint8_t *>(format + strlen(format) + 1);
+    const uint8_t *args_end = data + size;
+
+    recursion_guard_ = true;
+    this->reset_buffer_();
+    this->write_header_(record.level, tag, record.line, thread_name);
+    this->format_deferred_(format, args, args_end);
+    this->write_footer_();
+    // The tag lives in the record, so output the message before its space is freed
+    this->log_message_(record.level, tag);
+    // Free buffer space must be all zeroes, so that reserved records read as unfinished
+    memset(data, 0, size);
+    tail += size;
+    this->deferred_tail_.store(tail, std::memory_order_release);
+    recursion_guard_ = false;
+  }
+}
+
+void Logger::on_shutdown() { this->flush_deferred_(); }
+
+#ifdef USE_LOGGER_DEFERRED_TASKS
+uint32_t Logger::get_dropped_messages(int level) const {
+  return this->deferred_dropped_[level].load(std::memory_order_relaxed);
+}
+#endif
+
+template<typename T>
+void Logger::format_deferred_arg_(const char *spec, uint8_t stars, const int *star_args, T value) {
+  switch (stars) {
+    case 0:
+      this->printf_to_buffer_(spec, value);
+      break;
+    case 1:
+      this->printf_to_buffer_(spec, star_args[0], value);
+      break;
+    default:
+      this->printf_to_buffer_(spec, star_args[0], star_args[1], value);
+      break;
+  }
+}
+
+void Logger::format_deferred_(const char *format, const uint8_t *args, const uint8_t *args_end) {
+  const char *literal = format;
+  for (const char *p = format; *p != '\0'; p++) {
+    if (*p != '%')
+      continue;
+    this->write_to_buffer_(literal, p - literal);
+    FormatSpec spec = parse_format_spec(p);
+    p = spec.end - 1;
+    literal = spec.end;
+
+    char fmt[24];
+    size_t len = std::min<size_t>(spec.end - spec.begin, sizeof(fmt) - 1);
+    memcpy(fmt, spec.begin, len);
+    fmt[len] = '\0';
+    int star_args[2] = {0, 0};
+    for (uint8_t i = 0; i < spec.stars && i < 2; i++)
+      star_args[i] = get_deferred_arg<int>(args, args_end);
+
+    switch (spec.arg) {
+      case DeferredArg::NONE:
+        this->write_to_buffer_('%');
+        break;
+      case DeferredArg::INT:
+        this->format_deferred_arg_(fmt, spec.stars, star_args, get_deferred_arg<int>(args, args_end));
+        break;
+      case DeferredArg::LONG:
+        this->format_deferred_arg_(fmt, spec.stars, star_args, get_deferred_arg<long>(args, args_end));
+        break;
+      case DeferredArg::LONG_LONG:
+        this->format_deferred_arg_(fmt, spec.stars, star_args, get_deferred_arg<long long>(args, args_end));
+        break;
+      case DeferredArg::SIZE:
+        this->format_deferred_arg_(fmt, spec.stars, star_args, get_deferred_arg<size_t>(args, args_end));
+        break;
+      case DeferredArg::INTMAX:
+        this->format_deferred_arg_(fmt, spec.stars, star_args, get_deferred_arg<intmax_t>(args, args_end));
+        break;
+      case DeferredArg::PTRDIFF:
+        this->format_deferred_arg_(fmt, spec.stars, star_args, get_deferred_arg<ptrdiff_t>(args, args_end));
+        break;
+      case DeferredArg::DOUBLE:
+        this->format_deferred_arg_(fmt, spec.stars, star_args, get_deferred_arg<double>(args, args_end));
+        break;
+      case DeferredArg::LONG_DOUBLE:
+        this->format_deferred_arg_(fmt, spec.stars, star_args, get_deferred_arg<long double>(args, args_end));
+        break;
+      case DeferredArg::POINTER:
+        this->format_deferred_arg_(fmt, spec.stars, star_args, get_deferred_arg<void *>(args, args_end));
+        break;
+      case DeferredArg::STRING: {
+        const char *str = reinterpret_cast<const char *>(args);
+        size_t str_len = strnlen(str, args_end - args);
+        args += std::min<size_t>(str_len + 1, args_end - args);
+        this->format_deferred_arg_(fmt, spec.stars, star_args, str);
+        break;
+      }
+      case DeferredArg::UNSUPPORTED:
+        break;
+    }
+  }
+  this->write_to_buffer_(literal, strlen(literal));
+}
+#endif
+
+bool Logger::is_main_task_() const {
+#if defined(USE_ESP32) || defined(USE_LIBRETINY)
+  return xTaskGetCurrentTaskHandle() == this->main_task_;
+#else
+  return true;
+#endif
+}
+
 int HOT Logger::level_for(const char *tag) {
-  // Uses std::vector<> for low memory footprint, though the vector
-  // could be sorted to minimize lookup times. This feature isn't used that
-  // much anyway so it doesn't matter too much.
+  if (this->log_levels_.empty())
+    return ESPHOME_LOG_LEVEL;
+
+  // Tags are static strings, so their address identifies them. Only the main task updates the cache, other tasks
+  // log rarely and search the overrides instead.
+  TagLevelCacheEntry *entry = nullptr;
+  if (this->is_main_task_()) {
+    auto key = reinterpret_cast<uintptr_t>(tag);
+    entry = &this->tag_level_cache_[(key ^ (key >> 7)) % TAG_LEVEL_CACHE_SIZE];
+    if (entry->tag == tag)
+      return entry->level;
+  }
+
+  int level = ESPHOME_LOG_LEVEL;
   for (auto &it : this->log_levels_) {
     if (it.tag == tag) {
-      return it.level;
+      level = it.level;
+      break;
     }
   }
-  return ESPHOME_LOG_LEVEL;
+  if (entry != nullptr)
+    *entry = TagLevelCacheEntry{tag, level};
+  return level;
 }
 
 void HOT Logger::log_message_(int level, const char *tag, int offset) {
@@ -148,9 +683,22 @@ Logger::Logger(uint32_t baud_rate, size_t tx_buffer_size) : baud_rate_(baud_rate
 #endif
 }
 
-#ifdef USE_LOGGER_USB_CDC
+#if defined(USE_LOGGER_USB_CDC) || defined(USE_LOGGER_DEFERRED)
 void Logger::loop() {
-#ifdef USE_ARDUINO
+#ifdef USE_LOGGER_DEFERRED
+  this->flush_deferred_();
+#endif
+#ifdef USE_LOGGER_DEFERRED_TASKS
+  uint32_t dropped = 0;
+  for (auto &count : this->deferred_dropped_)
+    dropped += count.load(std::memory_order_relaxed);
+  if (dropped != this->deferred_dropped_reported_) {
+    ESP_LOGW(TAG, "%" PRIu32 " log messages from other tasks were dropped, the deferred buffer is too small",
+             dropped - this->deferred_dropped_reported_);
+    this->deferred_dropped_reported_ = dropped;
+  }
+#endif
+#if defined(USE_LOGGER_USB_CDC) && defined(USE_ARDUINO)
   if (this->uart_ != UART_SELECTION_USB_CDC) {
     return;
   }
@@ -169,6 +717,8 @@ void Logger::loop() {
 void Logger::set_baud_rate(uint32_t baud_rate) { this->baud_rate_ = baud_rate; }
 void Logger::set_log_level(const std::string &tag, int log_level) {
   this->log_levels_.push_back(LogLevelOverride{tag, log_level});
+  this->min_tag_level_ = std::min(this->min_tag_level_, log_level);
+  this->tag_level_cache_.assign(TAG_LEVEL_CACHE_SIZE, TagLevelCacheEntry{nullptr, 0});
 }
 
 #if defined(USE_ESP32) || defined(USE_ESP8266) || defined(USE_RP2040) || defined(USE_LIBRETINY)
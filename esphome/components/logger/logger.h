@@ -1,11 +1,13 @@
 #pragma once
 
+#include <atomic>
 #include <cstdarg>
 #include <vector>
 #include "esphome/core/automation.h"
 #include "esphome/core/component.h"
 #include "esphome/core/defines.h"
 #include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
 
 #ifdef USE_ARDUINO
 #if defined(USE_ESP8266) || defined(USE_ESP32)
@@ -56,8 +58,22 @@ enum UARTSelection {
 class Logger : public Component {
  public:
   explicit Logger(uint32_t baud_rate, size_t tx_buffer_size);
-#ifdef USE_LOGGER_USB_CDC
+#if defined(USE_LOGGER_USB_CDC) || defined(USE_LOGGER_DEFERRED)
   void loop() override;
+#endif
+#ifdef USE_LOGGER_DEFERRED
+  /** Queue log messages from the main task in a buffer of this size and format them later in loop().
+   *
+   * Only the tag, the format string and the raw arguments are copied when logging, so VERBOSE logging disturbs
+   * timing much less. Messages whose arguments don't fit are formatted synchronously.
+   */
+  void set_deferred_buffer_size(size_t size);
+  /// Output the queued messages before rebooting.
+  void on_shutdown() override;
+#ifdef USE_LOGGER_DEFERRED_TASKS
+  /// Number of messages of this level from other tasks that were dropped because the deferred buffer was full.
+  uint32_t get_dropped_messages(int level) const;
+#endif
 #endif
   /// Manually set the baud rate for serial, set to 0 to disable.
   void set_baud_rate(uint32_t baud_rate);
@@ -97,6 +113,8 @@ class Logger : public Component {
 
  protected:
   void write_header_(int level, const char *tag, int line);
+  /// Write the message header, the thread name is only shown for messages from other tasks than the main task.
+  void write_header_(int level, const char *tag, int line, const char *thread_name);
   void write_footer_();
   void log_message_(int level, const char *tag, int offset = 0);
   void write_msg_(const char *msg);
@@ -143,6 +161,34 @@ class Logger : public Component {
   const char *get_uart_selection_();
 #endif
 
+  bool is_main_task_() const;
+
+#ifdef USE_LOGGER_DEFERRED
+  /** Queue a log message, returns false if it has to be formatted synchronously instead.
+   *
+   * The main task flushes the buffer when it is full, other tasks drop the message instead.
+   */
+  bool defer_vprintf_(int level, const char *tag, int line, const char *format, va_list args, bool main_task);
+  /// Reserve room for a record of this size, returns its offset or the buffer size if it doesn't fit.
+  size_t reserve_deferred_(size_t size);
+  /// Format and output all queued log messages, called from the main task only.
+  void flush_deferred_();
+  void format_deferred_(const char *format, const uint8_t *args, const uint8_t *args_end);
+  template<typename T> void format_deferred_arg_(const char *spec, uint8_t stars, const int *star_args, T value);
+
+  uint8_t *deferred_buffer_{nullptr};
+  size_t deferred_size_{0};
+  /// Write position, advanced by every task that reserves room for a message.
+  std::atomic<size_t> deferred_head_{0};
+  /// Read position, only advanced by the main task. The buffer is empty when it equals the write position.
+  std::atomic<size_t> deferred_tail_{0};
+#ifdef USE_LOGGER_DEFERRED_TASKS
+  std::atomic<uint32_t> deferred_dropped_[ESPHOME_LOG_LEVEL_VERY_VERBOSE + 1]{};
+  /// Total number of dropped messages that were already reported.
+  uint32_t deferred_dropped_reported_{0};
+#endif
+#endif
+
   uint32_t baud_rate_;
   char *tx_buffer_{nullptr};
   int tx_buffer_at_{0};
@@ -164,6 +210,14 @@ class Logger : public Component {
     int level;
   };
   std::vector<LogLevelOverride> log_levels_;
+  struct TagLevelCacheEntry {
+    const char *tag;
+    int level;
+  };
+  /// Levels of recently seen tags by their address, so the overrides are only searched once per tag.
+  std::vector<TagLevelCacheEntry> tag_level_cache_;
+  /// Lowest level of all overrides, messages up to this level don't need a lookup.
+  int min_tag_level_{ESPHOME_LOG_LEVEL};
   CallbackManager<void(int, const char *, const char *)> log_callback_{};
   /// Prevents recursive log calls, if true a log message is already being processed.
   bool recursion_guard_ = false;
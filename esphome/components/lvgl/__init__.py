@@ -3,6 +3,7 @@ import logging
 from esphome.automation import build_automation, register_action, validate_automation
 import esphome.codegen as cg
 from esphome.components.display import Display
+from esphome.components.image import CONF_COMPRESS
 import esphome.config_validation as cv
 from esphome.const import (
     CONF_AUTO_CLEAR_ENABLED,
@@ -182,6 +183,10 @@ def final_validation(config):
             raise cv.Invalid(
                 "Using RGBA or RGB24 in image config not compatible with LVGL", path
             )
+        if image_conf.get(CONF_COMPRESS):
+            raise cv.Invalid(
+                "Using compress: true in image config not compatible with LVGL", path
+            )
 
 
 async def to_code(config):
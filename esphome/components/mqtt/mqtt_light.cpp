@@ -32,8 +32,12 @@ void MQTTJSONLightComponent::setup() {
 MQTTJSONLightComponent::MQTTJSONLightComponent(LightState *state) : state_(state) {}
 
 bool MQTTJSONLightComponent::publish_state_() {
-  return this->publish_json(this->get_state_topic_(),
-                            [this](JsonObject root) { LightJSONSchema::dump_json(*this->state_, root); });
+  std::string payload;
+  json::JsonWriter writer(payload);
+  writer.begin_object();
+  LightJSONSchema::dump_json(*this->state_, writer);
+  writer.end_object();
+  return this->publish(this->get_state_topic_(), payload);
 }
 LightState *MQTTJSONLightComponent::get_state() const { return this->state_; }
 
@@ -15,6 +15,8 @@ AUTO_LOAD = ["web_server_base"]
 prometheus_ns = cg.esphome_ns.namespace("prometheus")
 PrometheusHandler = prometheus_ns.class_("PrometheusHandler", cg.Component)
 
+CONF_GZIP = "gzip"
+
 CUSTOMIZED_ENTITY = cv.Schema(
     {
         cv.Optional(CONF_ID): cv.string_strict,
@@ -30,6 +32,7 @@ CONFIG_SCHEMA = cv.Schema(
             web_server_base.WebServerBase
         ),
         cv.Optional(CONF_INCLUDE_INTERNAL, default=False): cv.boolean,
+        cv.Optional(CONF_GZIP, default=False): cv.boolean,
         cv.Optional(CONF_RELABEL, default={}): cv.Schema(
             {
                 cv.use_id(EntityBase): CUSTOMIZED_ENTITY,
@@ -49,6 +52,8 @@ async def to_code(config):
     await cg.register_component(var, config)
 
     cg.add(var.set_include_internal(config[CONF_INCLUDE_INTERNAL]))
+    if config[CONF_GZIP]:
+        cg.add_define("USE_PROMETHEUS_GZIP")
 
     for key, value in config[CONF_RELABEL].items():
         entity = await cg.get_variable(key)
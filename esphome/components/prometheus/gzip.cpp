@@ -0,0 +1,184 @@
+#include "gzip.h"
+#ifdef USE_PROMETHEUS_GZIP
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+
+namespace esphome {
+namespace prometheus {
+
+static const uint8_t HASH_BITS = 10;
+static const size_t MIN_MATCH = 3;
+static const size_t MAX_MATCH = 258;
+static const size_t WINDOW_SIZE = 32768;
+
+static const uint16_t LENGTH_BASE[29] = {3,  4,  5,  6,  7,  8,  9,  10, 11,  13,  15,  17,  19,  23, 27,
+                                         31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+static const uint8_t LENGTH_EXTRA[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2,
+                                         2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+static const uint16_t DISTANCE_BASE[30] = {1,    2,    3,    4,    5,    7,    9,    13,    17,    25,
+                                           33,   49,   65,   97,   129,  193,  257,  385,   513,   769,
+                                           1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+static const uint8_t DISTANCE_EXTRA[30] = {0, 0, 0, 0, 1, 1, 2, 2,  3,  3,  4,  4,  5,  5,  6,
+                                           6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+namespace {
+
+/// Packs the deflate bit stream, which fills bytes starting at the least significant bit.
+class BitWriter {
+ public:
+  explicit BitWriter(std::string &output) : output_(output) {}
+
+  void write_bits(uint32_t value, uint8_t count) {
+    this->bits_ |= value << this->count_;
+    this->count_ += count;
+    while (this->count_ >= 8) {
+      this->output_.push_back(static_cast<char>(this->bits_ & 0xFF));
+      this->bits_ >>= 8;
+      this->count_ -= 8;
+    }
+  }
+  /// Huffman codes are packed starting at their most significant bit.
+  void write_code(uint32_t code, uint8_t count) {
+    uint32_t reversed = 0;
+    for (uint8_t i = 0; i < count; i++) {
+      reversed = (reversed << 1) | (code & 1);
+      code >>= 1;
+    }
+    this->write_bits(reversed, count);
+  }
+  void flush() {
+    if (this->count_ != 0)
+      this->output_.push_back(static_cast<char>(this->bits_ & 0xFF));
+    this->bits_ = 0;
+    this->count_ = 0;
+  }
+
+ protected:
+  std::string &output_;
+  uint32_t bits_{0};
+  uint8_t count_{0};
+};
+
+}  // namespace
+
+static void write_symbol(BitWriter &writer, uint16_t symbol) {
+  // Fixed literal/length codes from RFC 1951 section 3.2.6
+  if (symbol < 144) {
+    writer.write_code(0x30 + symbol, 8);
+  } else if (symbol < 256) {
+    writer.write_code(0x190 + symbol - 144, 9);
+  } else if (symbol < 280) {
+    writer.write_code(symbol - 256, 7);
+  } else {
+    writer.write_code(0xC0 + symbol - 280, 8);
+  }
+}
+
+static void write_match(BitWriter &writer, size_t length, size_t distance) {
+  uint8_t code = 28;
+  while (LENGTH_BASE[code] > length)
+    code--;
+  write_symbol(writer, 257 + code);
+  writer.write_bits(length - LENGTH_BASE[code], LENGTH_EXTRA[code]);
+
+  code = 29;
+  while (DISTANCE_BASE[code] > distance)
+    code--;
+  writer.write_code(code, 5);
+  writer.write_bits(distance - DISTANCE_BASE[code], DISTANCE_EXTRA[code]);
+}
+
+static uint32_t hash_at(const uint8_t *data) {
+  uint32_t value = (uint32_t(data[0]) << 16) | (uint32_t(data[1]) << 8) | data[2];
+  return static_cast<uint32_t>(value * 2654435761UL) >> (32 - HASH_BITS);
+}
+
+/// Continue the CRC-32 of the data before with this data, start with 0.
+static uint32_t crc32(uint32_t crc, const uint8_t *data, size_t len) {
+  crc = ~crc;
+  for (size_t i = 0; i < len; i++) {
+    crc ^= data[i];
+    for (uint8_t bit = 0; bit < 8; bit++)
+      crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+  }
+  return ~crc;
+}
+
+static void write_uint32_le(std::string &output, uint32_t value) {
+  for (uint8_t i = 0; i < 4; i++)
+    output.push_back(static_cast<char>((value >> (i * 8)) & 0xFF));
+}
+
+/// Compress the data into a deflate block with fixed Huffman codes, ending with the end of block symbol.
+static void deflate_block(BitWriter &writer, const uint8_t *data, size_t len, bool final) {
+  writer.write_bits(final ? 1 : 0, 1);
+  writer.write_bits(1, 2);
+
+  // Position + 1 of the last occurrence of each hash, 0 for none
+  std::unique_ptr<uint32_t[]> head(new uint32_t[1 << HASH_BITS]());
+  size_t pos = 0;
+  while (pos < len) {
+    size_t match_length = 0;
+    size_t match_distance = 0;
+    if (pos + MIN_MATCH <= len) {
+      uint32_t hash = hash_at(data + pos);
+      uint32_t candidate = head[hash];
+      head[hash] = pos + 1;
+      if (candidate != 0 && pos - (candidate - 1) <= WINDOW_SIZE) {
+        const uint8_t *match = data + candidate - 1;
+        size_t max_length = std::min(MAX_MATCH, len - pos);
+        size_t length = 0;
+        while (length < max_length && match[length] == data[pos + length])
+          length++;
+        if (length >= MIN_MATCH) {
+          match_length = length;
+          match_distance = data + pos - match;
+        }
+      }
+    }
+
+    if (match_length == 0) {
+      write_symbol(writer, data[pos]);
+      pos++;
+      continue;
+    }
+    write_match(writer, match_length, match_distance);
+    // Keep the hash table up to date for the bytes covered by the match
+    for (size_t i = pos + 1; i < pos + match_length && i + MIN_MATCH <= len; i++)
+      head[hash_at(data + i)] = i + 1;
+    pos += match_length;
+  }
+  // End of block
+  write_symbol(writer, 256);
+}
+
+uint32_t gzip_begin(const std::string &input, std::string &output) {
+  const auto *data = reinterpret_cast<const uint8_t *>(input.data());
+
+  // Header: magic, deflate, no flags, no modification time, no extra flags, unknown OS
+  static const char HEADER[10] = {'\x1f', '\x8b', 8, 0, 0, 0, 0, 0, 0, '\xff'};
+  output.append(HEADER, sizeof(HEADER));
+
+  BitWriter writer(output);
+  deflate_block(writer, data, input.size(), false);
+  // An empty stored block pads the stream to a byte boundary, so that gzip_finish() can append to it
+  writer.write_bits(0, 3);
+  writer.flush();
+  output.append("\x00\x00\xff\xff", 4);
+  return crc32(0, data, input.size());
+}
+
+void gzip_finish(const std::string &input, uint32_t crc, size_t size, std::string &output) {
+  const auto *data = reinterpret_cast<const uint8_t *>(input.data());
+  BitWriter writer(output);
+  deflate_block(writer, data, input.size(), true);
+  writer.flush();
+
+  write_uint32_le(output, crc32(crc, data, input.size()));
+  write_uint32_le(output, size + input.size());
+}
+
+}  // namespace prometheus
+}  // namespace esphome
+#endif
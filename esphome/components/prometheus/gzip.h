@@ -0,0 +1,28 @@
+#pragma once
+#include "esphome/core/defines.h"
+#ifdef USE_PROMETHEUS_GZIP
+#include <string>
+
+namespace esphome {
+namespace prometheus {
+
+/** Start a gzip member with the compressed data and append it to output.
+ *
+ * Uses fixed Huffman codes and a small single-probe hash table, so it needs just a few kB of heap while still
+ * compressing the repetitive exposition format well. The member ends on a byte boundary, so it can be cached and
+ * finished with different data each time.
+ *
+ * @return The CRC-32 of the data, for gzip_finish().
+ */
+uint32_t gzip_begin(const std::string &input, std::string &output);
+
+/** Append the compressed data and the trailer to a member started by gzip_begin(), closing it.
+ *
+ * @param crc The CRC-32 returned by gzip_begin().
+ * @param size The size of the data passed to gzip_begin().
+ */
+void gzip_finish(const std::string &input, uint32_t crc, size_t size, std::string &output);
+
+}  // namespace prometheus
+}  // namespace esphome
+#endif
@@ -1,58 +1,177 @@
 #include "prometheus_handler.h"
 #ifdef USE_NETWORK
 #include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+#ifdef USE_PROMETHEUS_GZIP
+#include "gzip.h"
+#endif
 
 namespace esphome {
 namespace prometheus {
 
-void PrometheusHandler::handleRequest(AsyncWebServerRequest *req) {
-  AsyncResponseStream *stream = req->beginResponseStream("text/plain; version=0.0.4; charset=utf-8");
+#ifdef USE_PROMETHEUS_GZIP
+static bool accepts_gzip(AsyncWebServerRequest *req) {
+#ifdef USE_ESP_IDF
+  auto encoding = req->get_header("Accept-Encoding");
+  return encoding.has_value() && encoding->find("gzip") != std::string::npos;
+#else
+  AsyncWebHeader *encoding = req->getHeader("Accept-Encoding");
+  return encoding != nullptr && encoding->value().indexOf("gzip") != -1;
+#endif
+}
+#endif
 
+void PrometheusHandler::setup() {
+  this->base_->init();
+  this->base_->add_handler(this);
+
+  // Only the rows of entities that changed are formatted again on the next scrape
 #ifdef USE_SENSOR
-  this->sensor_type_(stream);
-  for (auto *obj : App.get_sensors())
-    this->sensor_row_(stream, obj);
+  this->add_rows_([this](std::string &out) { this->sensor_type_(out); });
+  for (auto *obj : App.get_sensors()) {
+    if (obj->is_internal() && !this->include_internal_)
+      continue;
+    size_t index = this->add_rows_([this, obj](std::string &out) { this->sensor_row_(out, obj); });
+    obj->add_on_state_callback([this, index](float state) { this->mark_dirty_(index); });
+  }
 #endif
 
 #ifdef USE_BINARY_SENSOR
-  this->binary_sensor_type_(stream);
-  for (auto *obj : App.get_binary_sensors())
-    this->binary_sensor_row_(stream, obj);
+  this->add_rows_([this](std::string &out) { this->binary_sensor_type_(out); });
+  for (auto *obj : App.get_binary_sensors()) {
+    if (obj->is_internal() && !this->include_internal_)
+      continue;
+    size_t index = this->add_rows_([this, obj](std::string &out) { this->binary_sensor_row_(out, obj); });
+    obj->add_on_state_callback([this, index](bool state) { this->mark_dirty_(index); });
+  }
 #endif
 
 #ifdef USE_FAN
-  this->fan_type_(stream);
-  for (auto *obj : App.get_fans())
-    this->fan_row_(stream, obj);
+  this->add_rows_([this](std::string &out) { this->fan_type_(out); });
+  for (auto *obj : App.get_fans()) {
+    if (obj->is_internal() && !this->include_internal_)
+      continue;
+    size_t index = this->add_rows_([this, obj](std::string &out) { this->fan_row_(out, obj); });
+    obj->add_on_state_callback([this, index]() { this->mark_dirty_(index); });
+  }
 #endif
 
 #ifdef USE_LIGHT
-  this->light_type_(stream);
-  for (auto *obj : App.get_lights())
-    this->light_row_(stream, obj);
+  this->add_rows_([this](std::string &out) { this->light_type_(out); });
+  for (auto *obj : App.get_lights()) {
+    if (obj->is_internal() && !this->include_internal_)
+      continue;
+    size_t index = this->rows_.size();
+    this->add_rows_([this, obj, index](std::string &out) {
+      this->light_row_(out, obj);
+      // Transitions and effects don't call back on every step, keep the color fresh until they're done
+      if (obj->is_transformer_active() || obj->get_effect_name() != "None")
+        this->rows_[index].dirty.store(true, std::memory_order_relaxed);
+    });
+    obj->add_new_remote_values_callback([this, index]() { this->mark_dirty_(index); });
+  }
 #endif
 
 #ifdef USE_COVER
-  this->cover_type_(stream);
-  for (auto *obj : App.get_covers())
-    this->cover_row_(stream, obj);
+  this->add_rows_([this](std::string &out) { this->cover_type_(out); });
+  for (auto *obj : App.get_covers()) {
+    if (obj->is_internal() && !this->include_internal_)
+      continue;
+    size_t index = this->add_rows_([this, obj](std::string &out) { this->cover_row_(out, obj); });
+    obj->add_on_state_callback([this, index]() { this->mark_dirty_(index); });
+  }
 #endif
 
 #ifdef USE_SWITCH
-  this->switch_type_(stream);
-  for (auto *obj : App.get_switches())
-    this->switch_row_(stream, obj);
+  this->add_rows_([this](std::string &out) { this->switch_type_(out); });
+  for (auto *obj : App.get_switches()) {
+    if (obj->is_internal() && !this->include_internal_)
+      continue;
+    size_t index = this->add_rows_([this, obj](std::string &out) { this->switch_row_(out, obj); });
+    obj->add_on_state_callback([this, index](bool state) { this->mark_dirty_(index); });
+  }
 #endif
 
 #ifdef USE_LOCK
-  this->lock_type_(stream);
-  for (auto *obj : App.get_locks())
-    this->lock_row_(stream, obj);
+  this->add_rows_([this](std::string &out) { this->lock_type_(out); });
+  for (auto *obj : App.get_locks()) {
+    if (obj->is_internal() && !this->include_internal_)
+      continue;
+    size_t index = this->add_rows_([this, obj](std::string &out) { this->lock_row_(out, obj); });
+    obj->add_on_state_callback([this, index]() { this->mark_dirty_(index); });
+  }
+#endif
+}
+
+void PrometheusHandler::handleRequest(AsyncWebServerRequest *req) {
+  const uint32_t start = micros();
+  AsyncResponseStream *stream = req->beginResponseStream("text/plain; version=0.0.4; charset=utf-8");
+
+  {
+    LockGuard guard(this->lock_);
+    this->update_body_();
+#ifdef USE_PROMETHEUS_GZIP
+    const bool gzip = accepts_gzip(req);
+    if (gzip && this->gzip_body_.empty())
+      this->gzip_crc_ = gzip_begin(this->body_, this->gzip_body_);
 #endif
 
+    // The time it took to build the body, sending it isn't included
+    char scrape_duration[96];
+    snprintf(scrape_duration, sizeof(scrape_duration),
+             "#TYPE esphome_scrape_duration_seconds gauge\nesphome_scrape_duration_seconds %.6f\n",
+             (micros() - start) / 1e6f);
+
+#ifdef USE_PROMETHEUS_GZIP
+    if (gzip) {
+      // The duration finishes the cached gzip member, so clients read a single deflate stream
+      std::string tail;
+      gzip_finish(scrape_duration, this->gzip_crc_, this->body_.size(), tail);
+      stream->addHeader("Content-Encoding", "gzip");
+      stream->write(reinterpret_cast<const uint8_t *>(this->gzip_body_.data()), this->gzip_body_.size());
+      stream->write(reinterpret_cast<const uint8_t *>(tail.data()), tail.size());
+    } else
+#endif
+    {
+      stream->print(this->body_.c_str());
+      stream->print(scrape_duration);
+    }
+  }
+
   req->send(stream);
 }
 
+size_t PrometheusHandler::add_rows_(std::function<void(std::string &)> &&builder) {
+  CachedRows rows;
+  rows.builder = std::move(builder);
+  this->rows_.push_back(std::move(rows));
+  return this->rows_.size() - 1;
+}
+
+void PrometheusHandler::mark_dirty_(size_t index) { this->rows_[index].dirty.store(true, std::memory_order_relaxed); }
+
+void PrometheusHandler::update_body_() {
+  bool changed = false;
+  for (auto &rows : this->rows_) {
+    // Cleared before building, so a change while the rows are built marks them again
+    if (!rows.dirty.exchange(false, std::memory_order_relaxed))
+      continue;
+    rows.text.clear();
+    rows.builder(rows.text);
+    changed = true;
+  }
+  if (!changed)
+    return;
+
+  // The strings keep their capacity, so the body is usually rebuilt without allocating
+  this->body_.clear();
+  for (auto &rows : this->rows_)
+    this->body_.append(rows.text);
+#ifdef USE_PROMETHEUS_GZIP
+  this->gzip_body_.clear();
+#endif
+}
+
 std::string PrometheusHandler::relabel_id_(EntityBase *obj) {
   auto item = relabel_map_id_.find(obj);
   return item == relabel_map_id_.end() ? obj->get_object_id() : item->second;
@@ -65,287 +184,273 @@ std::string PrometheusHandler::relabel_name_(EntityBase *obj) {
 
 // Type-specific implementation
 #ifdef USE_SENSOR
-void PrometheusHandler::sensor_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_sensor_value gauge\n"));
-  stream->print(F("#TYPE esphome_sensor_failed gauge\n"));
+void PrometheusHandler::sensor_type_(std::string &out) {
+  out.append("#TYPE esphome_sensor_value gauge\n");
+  out.append("#TYPE esphome_sensor_failed gauge\n");
 }
-void PrometheusHandler::sensor_row_(AsyncResponseStream *stream, sensor::Sensor *obj) {
-  if (obj->is_internal() && !this->include_internal_)
-    return;
+void PrometheusHandler::sensor_row_(std::string &out, sensor::Sensor *obj) {
   if (!std::isnan(obj->state)) {
     // We have a valid value, output this value
-    stream->print(F("esphome_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 0\n"));
+    out.append("esphome_sensor_failed{id=\"");
+    out.append(relabel_id_(obj));
+    out.append("\",name=\"");
+    out.append(relabel_name_(obj));
+    out.append("\"} 0\n");
     // Data itself
-    stream->print(F("esphome_sensor_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\",unit=\""));
-    stream->print(obj->get_unit_of_measurement().c_str());
-    stream->print(F("\"} "));
-    stream->print(value_accuracy_to_string(obj->state, obj->get_accuracy_decimals()).c_str());
-    stream->print(F("\n"));
+    out.append("esphome_sensor_value{id=\"");
+    out.append(relabel_id_(obj));
+    out.append("\",name=\"");
+    out.append(relabel_name_(obj));
+    out.append("\",unit=\"");
+    out.append(obj->get_unit_of_measurement());
+    out.append("\"} ");
+    out.append(value_accuracy_to_string(obj->state, obj->get_accuracy_decimals()));
+    out.append("\n");
   } else {
     // Invalid state
-    stream->print(F("esphome_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 1\n"));
+    out.append("esphome_sensor_failed{id=\"");
+    out.append(relabel_id_(obj));
+    out.append("\",name=\"");
+    out.append(relabel_name_(obj));
+    out.append("\"} 1\n");
   }
 }
 #endif
 
 // Type-specific implementation
 #ifdef USE_BINARY_SENSOR
-void PrometheusHandler::binary_sensor_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_binary_sensor_value gauge\n"));
-  stream->print(F("#TYPE esphome_binary_sensor_failed gauge\n"));
+void PrometheusHandler::binary_sensor_type_(std::string &out) {
+  out.append("#TYPE esphome_binary_sensor_value gauge\n");
+  out.append("#TYPE esphome_binary_sensor_failed gauge\n");
 }
-void PrometheusHandler::binary_sensor_row_(AsyncResponseStream *stream, binary_sensor::BinarySensor *obj) {
-  if (obj->is_internal() && !this->include_internal_)
-    return;
+void PrometheusHandler::binary_sensor_row_(std::string &out, binary_sensor::BinarySensor *obj) {
   if (obj->has_state()) {
     // We have a valid value, output this value
-    stream->print(F("esphome_binary_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 0\n"));
+    out.append("esphome_binary_sensor_failed{id=\"");
+    out.append(relabel_id_(obj));
+    out.append("\",name=\"");
+    out.append(relabel_name_(obj));
+    out.append("\"} 0\n");
     // Data itself
-    stream->print(F("esphome_binary_sensor_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} "));
-    stream->print(obj->state);
-    stream->print(F("\n"));
+    out.append("esphome_binary_sensor_value{id=\"");
+    out.append(relabel_id_(obj));
+    out.append("\",name=\"");
+    out.append(relabel_name_(obj));
+    out.append("\"} ");
+    out.append(obj->state ? "1" : "0");
+    out.append("\n");
   } else {
     // Invalid state
-    stream->print(F("esphome_binary_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 1\n"));
+    out.append("esphome_binary_sensor_failed{id=\"");
+    out.append(relabel_id_(obj));
+    out.append("\",name=\"");
+    out.append(relabel_name_(obj));
+    out.append("\"} 1\n");
   }
 }
 #endif
 
 #ifdef USE_FAN
-void PrometheusHandler::fan_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_fan_value gauge\n"));
-  stream->print(F("#TYPE esphome_fan_failed gauge\n"));
-  stream->print(F("#TYPE esphome_fan_speed gauge\n"));
-  stream->print(F("#TYPE esphome_fan_oscillation gauge\n"));
+void PrometheusHandler::fan_type_(std::string &out) {
+  out.append("#TYPE esphome_fan_value gauge\n");
+  out.append("#TYPE esphome_fan_failed gauge\n");
+  out.append("#TYPE esphome_fan_speed gauge\n");
+  out.append("#TYPE esphome_fan_oscillation gauge\n");
 }
-void PrometheusHandler::fan_row_(AsyncResponseStream *stream, fan::Fan *obj) {
-  if (obj->is_internal() && !this->include_internal_)
-    return;
-  stream->print(F("esphome_fan_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} 0\n"));
+void PrometheusHandler::fan_row_(std::string &out, fan::Fan *obj) {
+  out.append("esphome_fan_failed{id=\"");
+  out.append(relabel_id_(obj));
+  out.append("\",name=\"");
+  out.append(relabel_name_(obj));
+  out.append("\"} 0\n");
   // Data itself
-  stream->print(F("esphome_fan_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} "));
-  stream->print(obj->state);
-  stream->print(F("\n"));
+  out.append("esphome_fan_value{id=\"");
+  out.append(relabel_id_(obj));
+  out.append("\",name=\"");
+  out.append(relabel_name_(obj));
+  out.append("\"} ");
+  out.append(obj->state ? "1" : "0");
+  out.append("\n");
   // Speed if available
   if (obj->get_traits().supports_speed()) {
-    stream->print(F("esphome_fan_speed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} "));
-    stream->print(obj->speed);
-    stream->print(F("\n"));
+    out.append("esphome_fan_speed{id=\"");
+    out.append(relabel_id_(obj));
+    out.append("\",name=\"");
+    out.append(relabel_name_(obj));
+    out.append("\"} ");
+    out.append(to_string(obj->speed));
+    out.append("\n");
   }
   // Oscillation if available
   if (obj->get_traits().supports_oscillation()) {
-    stream->print(F("esphome_fan_oscillation{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} "));
-    stream->print(obj->oscillating);
-    stream->print(F("\n"));
+    out.append("esphome_fan_oscillation{id=\"");
+    out.append(relabel_id_(obj));
+    out.append("\",name=\"");
+    out.append(relabel_name_(obj));
+    out.append("\"} ");
+    out.append(obj->oscillating ? "1" : "0");
+    out.append("\n");
   }
 }
 #endif
 
 #ifdef USE_LIGHT
-void PrometheusHandler::light_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_light_state gauge\n"));
-  stream->print(F("#TYPE esphome_light_color gauge\n"));
-  stream->print(F("#TYPE esphome_light_effect_active gauge\n"));
+void PrometheusHandler::light_type_(std::string &out) {
+  out.append("#TYPE esphome_light_state gauge\n");
+  out.append("#TYPE esphome_light_color gauge\n");
+  out.append("#TYPE esphome_light_effect_active gauge\n");
 }
-void PrometheusHandler::light_row_(AsyncResponseStream *stream, light::LightState *obj) {
-  if (obj->is_internal() && !this->include_internal_)
-    return;
+void PrometheusHandler::light_row_(std::string &out, light::LightState *obj) {
   // State
-  stream->print(F("esphome_light_state{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} "));
-  stream->print(obj->remote_values.is_on());
-  stream->print(F("\n"));
+  out.append("esphome_light_state{id=\"");
+  out.append(relabel_id_(obj));
+  out.append("\",name=\"");
+  out.append(relabel_name_(obj));
+  out.append("\"} ");
+  out.append(obj->remote_values.is_on() ? "1" : "0");
+  out.append("\n");
   // Brightness and RGBW
   light::LightColorValues color = obj->current_values;
   float brightness, r, g, b, w;
   color.as_brightness(&brightness);
   color.as_rgbw(&r, &g, &b, &w);
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\",channel=\"brightness\"} "));
-  stream->print(brightness);
-  stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\",channel=\"r\"} "));
-  stream->print(r);
-  stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\",channel=\"g\"} "));
-  stream->print(g);
-  stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\",channel=\"b\"} "));
-  stream->print(b);
-  stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\",channel=\"w\"} "));
-  stream->print(w);
-  stream->print(F("\n"));
+  out.append("esphome_light_color{id=\"");
+  out.append(relabel_id_(obj));
+  out.append("\",name=\"");
+  out.append(relabel_name_(obj));
+  out.append("\",channel=\"brightness\"} ");
+  out.append(value_accuracy_to_string(brightness, 2));
+  out.append("\n");
+  out.append("esphome_light_color{id=\"");
+  out.append(relabel_id_(obj));
+  out.append("\",name=\"");
+  out.append(relabel_name_(obj));
+  out.append("\",channel=\"r\"} ");
+  out.append(value_accuracy_to_string(r, 2));
+  out.append("\n");
+  out.append("esphome_light_color{id=\"");
+  out.append(relabel_id_(obj));
+  out.append("\",name=\"");
+  out.append(relabel_name_(obj));
+  out.append("\",channel=\"g\"} ");
+  out.append(value_accuracy_to_string(g, 2));
+  out.append("\n");
+  out.append("esphome_light_color{id=\"");
+  out.append(relabel_id_(obj));
+  out.append("\",name=\"");
+  out.append(relabel_name_(obj));
+  out.append("\",channel=\"b\"} ");
+  out.append(value_accuracy_to_string(b, 2));
+  out.append("\n");
+  out.append("esphome_light_color{id=\"");
+  out.append(relabel_id_(obj));
+  out.append("\",name=\"");
+  out.append(relabel_name_(obj));
+  out.append("\",channel=\"w\"} ");
+  out.append(value_accuracy_to_string(w, 2));
+  out.append("\n");
   // Effect
   std::string effect = obj->get_effect_name();
   if (effect == "None") {
-    stream->print(F("esphome_light_effect_active{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\",effect=\"None\"} 0\n"));
+    out.append("esphome_light_effect_active{id=\"");
+    out.append(relabel_id_(obj));
+    out.append("\",name=\"");
+    out.append(relabel_name_(obj));
+    out.append("\",effect=\"None\"} 0\n");
   } else {
-    stream->print(F("esphome_light_effect_active{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\",effect=\""));
-    stream->print(effect.c_str());
-    stream->print(F("\"} 1\n"));
+    out.append("esphome_light_effect_active{id=\"");
+    out.append(relabel_id_(obj));
+    out.append("\",name=\"");
+    out.append(relabel_name_(obj));
+    out.append("\",effect=\"");
+    out.append(effect);
+    out.append("\"} 1\n");
   }
 }
 #endif
 
 #ifdef USE_COVER
-void PrometheusHandler::cover_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_cover_value gauge\n"));
-  stream->print(F("#TYPE esphome_cover_failed gauge\n"));
+void PrometheusHandler::cover_type_(std::string &out) {
+  out.append("#TYPE esphome_cover_value gauge\n");
+  out.append("#TYPE esphome_cover_failed gauge\n");
 }
-void PrometheusHandler::cover_row_(AsyncResponseStream *stream, cover::Cover *obj) {
-  if (obj->is_internal() && !this->include_internal_)
-    return;
+void PrometheusHandler::cover_row_(std::string &out, cover::Cover *obj) {
   if (!std::isnan(obj->position)) {
     // We have a valid value, output this value
-    stream->print(F("esphome_cover_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 0\n"));
+    out.append("esphome_cover_failed{id=\"");
+    out.append(relabel_id_(obj));
+    out.append("\",name=\"");
+    out.append(relabel_name_(obj));
+    out.append("\"} 0\n");
     // Data itself
-    stream->print(F("esphome_cover_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} "));
-    stream->print(obj->position);
-    stream->print(F("\n"));
+    out.append("esphome_cover_value{id=\"");
+    out.append(relabel_id_(obj));
+    out.append("\",name=\"");
+    out.append(relabel_name_(obj));
+    out.append("\"} ");
+    out.append(value_accuracy_to_string(obj->position, 2));
+    out.append("\n");
     if (obj->get_traits().get_supports_tilt()) {
-      stream->print(F("esphome_cover_tilt{id=\""));
-      stream->print(relabel_id_(obj).c_str());
-      stream->print(F("\",name=\""));
-      stream->print(relabel_name_(obj).c_str());
-      stream->print(F("\"} "));
-      stream->print(obj->tilt);
-      stream->print(F("\n"));
+      out.append("esphome_cover_tilt{id=\"");
+      out.append(relabel_id_(obj));
+      out.append("\",name=\"");
+      out.append(relabel_name_(obj));
+      out.append("\"} ");
+      out.append(value_accuracy_to_string(obj->tilt, 2));
+      out.append("\n");
     }
   } else {
     // Invalid state
-    stream->print(F("esphome_cover_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 1\n"));
+    out.append("esphome_cover_failed{id=\"");
+    out.append(relabel_id_(obj));
+    out.append("\",name=\"");
+    out.append(relabel_name_(obj));
+    out.append("\"} 1\n");
   }
 }
 #endif
 
 #ifdef USE_SWITCH
-void PrometheusHandler::switch_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_switch_value gauge\n"));
-  stream->print(F("#TYPE esphome_switch_failed gauge\n"));
+void PrometheusHandler::switch_type_(std::string &out) {
+  out.append("#TYPE esphome_switch_value gauge\n");
+  out.append("#TYPE esphome_switch_failed gauge\n");
 }
-void PrometheusHandler::switch_row_(AsyncResponseStream *stream, switch_::Switch *obj) {
-  if (obj->is_internal() && !this->include_internal_)
-    return;
-  stream->print(F("esphome_switch_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} 0\n"));
+void PrometheusHandler::switch_row_(std::string &out, switch_::Switch *obj) {
+  out.append("esphome_switch_failed{id=\"");
+  out.append(relabel_id_(obj));
+  out.append("\",name=\"");
+  out.append(relabel_name_(obj));
+  out.append("\"} 0\n");
   // Data itself
-  stream->print(F("esphome_switch_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} "));
-  stream->print(obj->state);
-  stream->print(F("\n"));
+  out.append("esphome_switch_value{id=\"");
+  out.append(relabel_id_(obj));
+  out.append("\",name=\"");
+  out.append(relabel_name_(obj));
+  out.append("\"} ");
+  out.append(obj->state ? "1" : "0");
+  out.append("\n");
 }
 #endif
 
 #ifdef USE_LOCK
-void PrometheusHandler::lock_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_lock_value gauge\n"));
-  stream->print(F("#TYPE esphome_lock_failed gauge\n"));
+void PrometheusHandler::lock_type_(std::string &out) {
+  out.append("#TYPE esphome_lock_value gauge\n");
+  out.append("#TYPE esphome_lock_failed gauge\n");
 }
-void PrometheusHandler::lock_row_(AsyncResponseStream *stream, lock::Lock *obj) {
-  if (obj->is_internal() && !this->include_internal_)
-    return;
-  stream->print(F("esphome_lock_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} 0\n"));
+void PrometheusHandler::lock_row_(std::string &out, lock::Lock *obj) {
+  out.append("esphome_lock_failed{id=\"");
+  out.append(relabel_id_(obj));
+  out.append("\",name=\"");
+  out.append(relabel_name_(obj));
+  out.append("\"} 0\n");
   // Data itself
-  stream->print(F("esphome_lock_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} "));
-  stream->print(obj->state);
-  stream->print(F("\n"));
+  out.append("esphome_lock_value{id=\"");
+  out.append(relabel_id_(obj));
+  out.append("\",name=\"");
+  out.append(relabel_name_(obj));
+  out.append("\"} ");
+  out.append(to_string(static_cast<int>(obj->state)));
+  out.append("\n");
 }
 #endif
 
@@ -1,13 +1,18 @@
 #pragma once
 #include "esphome/core/defines.h"
 #ifdef USE_NETWORK
+#include <atomic>
+#include <functional>
 #include <map>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "esphome/components/web_server_base/web_server_base.h"
 #include "esphome/core/component.h"
 #include "esphome/core/controller.h"
 #include "esphome/core/entity_base.h"
+#include "esphome/core/helpers.h"
 
 namespace esphome {
 namespace prometheus {
@@ -39,8 +44,13 @@ class PrometheusHandler : public AsyncWebHandler, public Component {
 
   bool canHandle(AsyncWebServerRequest *request) override {
     if (request->method() == HTTP_GET) {
-      if (request->url() == "/metrics")
+      if (request->url() == "/metrics") {
+#if defined(USE_ARDUINO) && defined(USE_PROMETHEUS_GZIP)
+        // Keep the header around until the request is handled, only required in Arduino framework
+        request->addInterestingHeader("Accept-Encoding");
+#endif
         return true;
+      }
     }
 
     return false;
@@ -48,72 +58,96 @@ class PrometheusHandler : public AsyncWebHandler, public Component {
 
   void handleRequest(AsyncWebServerRequest *req) override;
 
-  void setup() override {
-    this->base_->init();
-    this->base_->add_handler(this);
-  }
+  void setup() override;
   float get_setup_priority() const override {
     // After WiFi
     return setup_priority::WIFI - 1.0f;
   }
 
  protected:
+  /// The cached exposition text of one entity, or of the type comments of a platform.
+  struct CachedRows {
+    CachedRows() = default;
+    CachedRows(CachedRows &&other)
+        : builder(std::move(other.builder)), text(std::move(other.text)), dirty(other.dirty.load()) {}
+
+    std::function<void(std::string &)> builder;
+    std::string text;
+    /// Set by state callbacks on the main loop without taking the lock, so scrapes never block it.
+    std::atomic<bool> dirty{true};
+  };
+
+  /// Add rows to the exposition text and return their index.
+  size_t add_rows_(std::function<void(std::string &)> &&builder);
+  void mark_dirty_(size_t index);
+  /// Rebuild the rows of the entities that changed and the body when there were any.
+  void update_body_();
+
   std::string relabel_id_(EntityBase *obj);
   std::string relabel_name_(EntityBase *obj);
 
 #ifdef USE_SENSOR
   /// Return the type for prometheus
-  void sensor_type_(AsyncResponseStream *stream);
+  void sensor_type_(std::string &out);
   /// Return the sensor state as prometheus data point
-  void sensor_row_(AsyncResponseStream *stream, sensor::Sensor *obj);
+  void sensor_row_(std::string &out, sensor::Sensor *obj);
 #endif
 
 #ifdef USE_BINARY_SENSOR
   /// Return the type for prometheus
-  void binary_sensor_type_(AsyncResponseStream *stream);
+  void binary_sensor_type_(std::string &out);
   /// Return the sensor state as prometheus data point
-  void binary_sensor_row_(AsyncResponseStream *stream, binary_sensor::BinarySensor *obj);
+  void binary_sensor_row_(std::string &out, binary_sensor::BinarySensor *obj);
 #endif
 
 #ifdef USE_FAN
   /// Return the type for prometheus
-  void fan_type_(AsyncResponseStream *stream);
+  void fan_type_(std::string &out);
   /// Return the sensor state as prometheus data point
-  void fan_row_(AsyncResponseStream *stream, fan::Fan *obj);
+  void fan_row_(std::string &out, fan::Fan *obj);
 #endif
 
 #ifdef USE_LIGHT
   /// Return the type for prometheus
-  void light_type_(AsyncResponseStream *stream);
+  void light_type_(std::string &out);
   /// Return the Light Values state as prometheus data point
-  void light_row_(AsyncResponseStream *stream, light::LightState *obj);
+  void light_row_(std::string &out, light::LightState *obj);
 #endif
 
 #ifdef USE_COVER
   /// Return the type for prometheus
-  void cover_type_(AsyncResponseStream *stream);
+  void cover_type_(std::string &out);
   /// Return the switch Values state as prometheus data point
-  void cover_row_(AsyncResponseStream *stream, cover::Cover *obj);
+  void cover_row_(std::string &out, cover::Cover *obj);
 #endif
 
 #ifdef USE_SWITCH
   /// Return the type for prometheus
-  void switch_type_(AsyncResponseStream *stream);
+  void switch_type_(std::string &out);
   /// Return the switch Values state as prometheus data point
-  void switch_row_(AsyncResponseStream *stream, switch_::Switch *obj);
+  void switch_row_(std::string &out, switch_::Switch *obj);
 #endif
 
 #ifdef USE_LOCK
   /// Return the type for prometheus
-  void lock_type_(AsyncResponseStream *stream);
+  void lock_type_(std::string &out);
   /// Return the lock Values state as prometheus data point
-  void lock_row_(AsyncResponseStream *stream, lock::Lock *obj);
+  void lock_row_(std::string &out, lock::Lock *obj);
 #endif
 
   web_server_base::WebServerBase *base_;
   bool include_internal_{false};
   std::map<EntityBase *, std::string> relabel_map_id_;
   std::map<EntityBase *, std::string> relabel_map_name_;
+  std::vector<CachedRows> rows_;
+  std::string body_;
+#ifdef USE_PROMETHEUS_GZIP
+  /// The compressed body as the start of a gzip member, empty when it must be compressed again.
+  std::string gzip_body_;
+  uint32_t gzip_crc_{0};
+#endif
+  /// Guards the text of the rows and the body, the web server may handle requests in its own task.
+  Mutex lock_;
 };
 
 }  // namespace prometheus
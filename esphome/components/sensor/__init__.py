@@ -34,6 +34,7 @@ from esphome.const import (
     CONF_TO,
     CONF_TRIGGER_ID,
     CONF_TYPE,
+    CONF_TYPE_ID,
     CONF_UNIT_OF_MEASUREMENT,
     CONF_VALUE,
     CONF_WEB_SERVER_ID,
@@ -179,6 +180,18 @@ def validate_send_first_at(value):
 FILTER_REGISTRY = Registry()
 validate_filters = cv.validate_registry("filter", FILTER_REGISTRY)
 
+# Stateless filters that build_filters() can fuse with their neighbours, by filter name.
+# Each one maps to its stage type and a function that returns the constructor arguments.
+FILTER_STAGES = {}
+
+
+def register_filter_stage(name, stage_type):
+    def decorator(fun):
+        FILTER_STAGES[name] = (stage_type, fun)
+        return fun
+
+    return decorator
+
 
 def validate_datapoint(value):
     if isinstance(value, dict):
@@ -251,6 +264,14 @@ SensorInRangeCondition = sensor_ns.class_("SensorInRangeCondition", Filter)
 ClampFilter = sensor_ns.class_("ClampFilter", Filter)
 RoundFilter = sensor_ns.class_("RoundFilter", Filter)
 RoundMultipleFilter = sensor_ns.class_("RoundMultipleFilter", Filter)
+FusedFilter = sensor_ns.class_("FusedFilter", Filter)
+
+# Stages of stateless filters
+OffsetStage = sensor_ns.struct("OffsetStage")
+MultiplyStage = sensor_ns.struct("MultiplyStage")
+ClampStage = sensor_ns.struct("ClampStage")
+RoundStage = sensor_ns.struct("RoundStage")
+RoundMultipleStage = sensor_ns.struct("RoundMultipleStage")
 
 validate_unit_of_measurement = cv.string_strict
 validate_accuracy_decimals = cv.int_
@@ -340,11 +361,21 @@ async def offset_filter_to_code(config, filter_id):
     return cg.new_Pvariable(filter_id, config)
 
 
+@register_filter_stage("offset", OffsetStage)
+def offset_filter_stage(config):
+    return [config]
+
+
 @FILTER_REGISTRY.register("multiply", MultiplyFilter, cv.float_)
 async def multiply_filter_to_code(config, filter_id):
     return cg.new_Pvariable(filter_id, config)
 
 
+@register_filter_stage("multiply", MultiplyStage)
+def multiply_filter_stage(config):
+    return [config]
+
+
 @FILTER_REGISTRY.register("filter_out", FilterOutValueFilter, cv.float_)
 async def filter_out_filter_to_code(config, filter_id):
     return cg.new_Pvariable(filter_id, config)
@@ -719,6 +750,15 @@ async def clamp_filter_to_code(config, filter_id):
     )
 
 
+@register_filter_stage("clamp", ClampStage)
+def clamp_filter_stage(config):
+    return [
+        config[CONF_MIN_VALUE],
+        config[CONF_MAX_VALUE],
+        config[CONF_IGNORE_OUT_OF_RANGE],
+    ]
+
+
 @FILTER_REGISTRY.register(
     "round",
     RoundFilter,
@@ -736,6 +776,11 @@ async def round_filter_to_code(config, filter_id):
     )
 
 
+@register_filter_stage("round", RoundStage)
+def round_filter_stage(config):
+    return [config[CONF_ACCURACY_DECIMALS]]
+
+
 @FILTER_REGISTRY.register(
     "round_to_multiple_of",
     RoundMultipleFilter,
@@ -753,8 +798,44 @@ async def round_multiple_filter_to_code(config, filter_id):
     )
 
 
+@register_filter_stage("round_to_multiple_of", RoundMultipleStage)
+def round_multiple_filter_stage(config):
+    return [config[CONF_MULTIPLE]]
+
+
 async def build_filters(config):
-    return await cg.build_registry_list(FILTER_REGISTRY, config)
+    """Build the filter chain, fusing runs of stateless filters into one FusedFilter."""
+    filters = []
+    run = []
+
+    async def flush_run():
+        if len(run) == 1:
+            filters.append(await cg.build_registry_entry(FILTER_REGISTRY, run[0]))
+        elif run:
+            stage_types = []
+            stages = []
+            for conf in run:
+                registry_entry, filter_config = cg.extract_registry_entry_config(
+                    FILTER_REGISTRY, conf
+                )
+                stage_type, stage_args = FILTER_STAGES[registry_entry.name]
+                stage_types.append(stage_type)
+                stages.append(stage_type(*stage_args(filter_config)))
+            fused_id = run[0][CONF_TYPE_ID].copy()
+            fused_id.type = FusedFilter
+            template_args = cg.TemplateArguments(*stage_types)
+            filters.append(cg.new_Pvariable(fused_id, template_args, *stages))
+        run.clear()
+
+    for conf in config:
+        registry_entry, _ = cg.extract_registry_entry_config(FILTER_REGISTRY, conf)
+        if registry_entry.name in FILTER_STAGES:
+            run.append(conf)
+            continue
+        await flush_run()
+        filters.append(await cg.build_registry_entry(FILTER_REGISTRY, conf))
+    await flush_run()
+    return filters
 
 
 async def setup_sensor_core_(var, config):
@@ -1,4 +1,5 @@
 #include "filter.h"
+#include <algorithm>
 #include <cmath>
 #include "esphome/core/hal.h"
 #include "esphome/core/log.h"
@@ -25,12 +26,32 @@ void Filter::output(float value) {
     this->next_->input(value);
   }
 }
+size_t Filter::new_values(float *values, size_t count) {
+  size_t out = 0;
+  for (size_t i = 0; i < count; i++) {
+    optional<float> value = this->new_value(values[i]);
+    if (value.has_value())
+      values[out++] = *value;
+  }
+  return out;
+}
 void Filter::initialize(Sensor *parent, Filter *next) {
   ESP_LOGVV(TAG, "Filter(%p)::initialize(parent=%p next=%p)", this, parent, next);
   this->parent_ = parent;
   this->next_ = next;
 }
 
+/// Insert a value into a sorted vector, after all values that are equal to it.
+static void sorted_insert(std::vector<float> &sorted, float value) {
+  sorted.insert(std::upper_bound(sorted.begin(), sorted.end(), value), value);
+}
+/// Remove one occurrence of a value from a sorted vector.
+static void sorted_erase(std::vector<float> &sorted, float value) {
+  auto it = std::lower_bound(sorted.begin(), sorted.end(), value);
+  if (it != sorted.end() && *it == value)
+    sorted.erase(it);
+}
+
 // MedianFilter
 MedianFilter::MedianFilter(size_t window_size, size_t send_every, size_t send_first_at)
     : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {}
@@ -38,33 +59,25 @@ void MedianFilter::set_send_every(size_t send_every) { this->send_every_ = send_
 void MedianFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
 optional<float> MedianFilter::new_value(float value) {
   while (this->queue_.size() >= this->window_size_) {
+    if (!std::isnan(this->queue_.front()))
+      sorted_erase(this->sorted_, this->queue_.front());
     this->queue_.pop_front();
   }
   this->queue_.push_back(value);
+  if (!std::isnan(value))
+    sorted_insert(this->sorted_, value);
   ESP_LOGVV(TAG, "MedianFilter(%p)::new_value(%f)", this, value);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
     float median = NAN;
-    if (!this->queue_.empty()) {
-      // Copy queue without NaN values
-      std::vector<float> median_queue;
-      for (auto v : this->queue_) {
-        if (!std::isnan(v)) {
-          median_queue.push_back(v);
-        }
-      }
-
-      sort(median_queue.begin(), median_queue.end());
-
-      size_t queue_size = median_queue.size();
-      if (queue_size) {
-        if (queue_size % 2) {
-          median = median_queue[queue_size / 2];
-        } else {
-          median = (median_queue[queue_size / 2] + median_queue[(queue_size / 2) - 1]) / 2.0f;
-        }
+    size_t queue_size = this->sorted_.size();
+    if (queue_size) {
+      if (queue_size % 2) {
+        median = this->sorted_[queue_size / 2];
+      } else {
+        median = (this->sorted_[queue_size / 2] + this->sorted_[(queue_size / 2) - 1]) / 2.0f;
       }
     }
 
@@ -95,32 +108,24 @@ void QuantileFilter::set_window_size(size_t window_size) { this->window_size_ =
 void QuantileFilter::set_quantile(float quantile) { this->quantile_ = quantile; }
 optional<float> QuantileFilter::new_value(float value) {
   while (this->queue_.size() >= this->window_size_) {
+    if (!std::isnan(this->queue_.front()))
+      sorted_erase(this->sorted_, this->queue_.front());
     this->queue_.pop_front();
   }
   this->queue_.push_back(value);
+  if (!std::isnan(value))
+    sorted_insert(this->sorted_, value);
   ESP_LOGVV(TAG, "QuantileFilter(%p)::new_value(%f), quantile:%f", this, value, this->quantile_);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
     float result = NAN;
-    if (!this->queue_.empty()) {
-      // Copy queue without NaN values
-      std::vector<float> quantile_queue;
-      for (auto v : this->queue_) {
-        if (!std::isnan(v)) {
-          quantile_queue.push_back(v);
-        }
-      }
-
-      sort(quantile_queue.begin(), quantile_queue.end());
-
-      size_t queue_size = quantile_queue.size();
-      if (queue_size) {
-        size_t position = ceilf(queue_size * this->quantile_) - 1;
-        ESP_LOGVV(TAG, "QuantileFilter(%p)::position: %d/%d", this, position + 1, queue_size);
-        result = quantile_queue[position];
-      }
+    size_t queue_size = this->sorted_.size();
+    if (queue_size) {
+      size_t position = ceilf(queue_size * this->quantile_) - 1;
+      ESP_LOGVV(TAG, "QuantileFilter(%p)::position: %d/%d", this, position + 1, queue_size);
+      result = this->sorted_[position];
     }
 
     ESP_LOGVV(TAG, "QuantileFilter(%p)::new_value(%f) SENDING %f", this, value, result);
@@ -135,21 +140,24 @@ MinFilter::MinFilter(size_t window_size, size_t send_every, size_t send_first_at
 void MinFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
 void MinFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
 optional<float> MinFilter::new_value(float value) {
-  while (this->queue_.size() >= this->window_size_) {
-    this->queue_.pop_front();
+  this->count_++;
+  // Drop the candidates that left the window
+  while (!this->candidates_.empty() && this->count_ - this->candidates_.front().first >= this->window_size_) {
+    this->candidates_.pop_front();
+  }
+  if (!std::isnan(value)) {
+    // Older values that are not smaller than this one can't become the minimum anymore
+    while (!this->candidates_.empty() && this->candidates_.back().second >= value) {
+      this->candidates_.pop_back();
+    }
+    this->candidates_.emplace_back(this->count_, value);
   }
-  this->queue_.push_back(value);
   ESP_LOGVV(TAG, "MinFilter(%p)::new_value(%f)", this, value);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
-    float min = NAN;
-    for (auto v : this->queue_) {
-      if (!std::isnan(v)) {
-        min = std::isnan(min) ? v : std::min(min, v);
-      }
-    }
+    float min = this->candidates_.empty() ? NAN : this->candidates_.front().second;
 
     ESP_LOGVV(TAG, "MinFilter(%p)::new_value(%f) SENDING %f", this, value, min);
     return min;
@@ -163,21 +171,24 @@ MaxFilter::MaxFilter(size_t window_size, size_t send_every, size_t send_first_at
 void MaxFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
 void MaxFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
 optional<float> MaxFilter::new_value(float value) {
-  while (this->queue_.size() >= this->window_size_) {
-    this->queue_.pop_front();
+  this->count_++;
+  // Drop the candidates that left the window
+  while (!this->candidates_.empty() && this->count_ - this->candidates_.front().first >= this->window_size_) {
+    this->candidates_.pop_front();
+  }
+  if (!std::isnan(value)) {
+    // Older values that are not larger than this one can't become the maximum anymore
+    while (!this->candidates_.empty() && this->candidates_.back().second <= value) {
+      this->candidates_.pop_back();
+    }
+    this->candidates_.emplace_back(this->count_, value);
   }
-  this->queue_.push_back(value);
   ESP_LOGVV(TAG, "MaxFilter(%p)::new_value(%f)", this, value);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
-    float max = NAN;
-    for (auto v : this->queue_) {
-      if (!std::isnan(v)) {
-        max = std::isnan(max) ? v : std::max(max, v);
-      }
-    }
+    float max = this->candidates_.empty() ? NAN : this->candidates_.front().second;
 
     ESP_LOGVV(TAG, "MaxFilter(%p)::new_value(%f) SENDING %f", this, value, max);
     return max;
@@ -288,14 +299,20 @@ optional<float> LambdaFilter::new_value(float value) {
 }
 
 // OffsetFilter
-OffsetFilter::OffsetFilter(float offset) : offset_(offset) {}
+OffsetFilter::OffsetFilter(float offset) : stage_(offset) {}
 
-optional<float> OffsetFilter::new_value(float value) { return value + this->offset_; }
+optional<float> OffsetFilter::new_value(float value) {
+  this->stage_.apply(value);
+  return value;
+}
 
 // MultiplyFilter
-MultiplyFilter::MultiplyFilter(float multiplier) : multiplier_(multiplier) {}
+MultiplyFilter::MultiplyFilter(float multiplier) : stage_(multiplier) {}
 
-optional<float> MultiplyFilter::new_value(float value) { return value * this->multiplier_; }
+optional<float> MultiplyFilter::new_value(float value) {
+  this->stage_.apply(value);
+  return value;
+}
 
 // FilterOutValueFilter
 FilterOutValueFilter::FilterOutValueFilter(float value_to_filter_out) : value_to_filter_out_(value_to_filter_out) {}
@@ -440,43 +457,22 @@ optional<float> CalibratePolynomialFilter::new_value(float value) {
   return res;
 }
 
-ClampFilter::ClampFilter(float min, float max, bool ignore_out_of_range)
-    : min_(min), max_(max), ignore_out_of_range_(ignore_out_of_range) {}
+ClampFilter::ClampFilter(float min, float max, bool ignore_out_of_range) : stage_(min, max, ignore_out_of_range) {}
 optional<float> ClampFilter::new_value(float value) {
-  if (std::isfinite(value)) {
-    if (std::isfinite(this->min_) && value < this->min_) {
-      if (this->ignore_out_of_range_) {
-        return {};
-      } else {
-        return this->min_;
-      }
-    }
-
-    if (std::isfinite(this->max_) && value > this->max_) {
-      if (this->ignore_out_of_range_) {
-        return {};
-      } else {
-        return this->max_;
-      }
-    }
-  }
+  if (!this->stage_.apply(value))
+    return {};
   return value;
 }
 
-RoundFilter::RoundFilter(uint8_t precision) : precision_(precision) {}
+RoundFilter::RoundFilter(uint8_t precision) : stage_(precision) {}
 optional<float> RoundFilter::new_value(float value) {
-  if (std::isfinite(value)) {
-    float accuracy_mult = powf(10.0f, this->precision_);
-    return roundf(accuracy_mult * value) / accuracy_mult;
-  }
+  this->stage_.apply(value);
   return value;
 }
 
-RoundMultipleFilter::RoundMultipleFilter(float multiple) : multiple_(multiple) {}
+RoundMultipleFilter::RoundMultipleFilter(float multiple) : stage_(multiple) {}
 optional<float> RoundMultipleFilter::new_value(float value) {
-  if (std::isfinite(value)) {
-    return value - remainderf(value, this->multiple_);
-  }
+  this->stage_.apply(value);
   return value;
 }
 
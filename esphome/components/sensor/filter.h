@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cmath>
 #include <queue>
+#include <tuple>
 #include <utility>
 #include <vector>
 #include "esphome/core/component.h"
@@ -29,6 +31,16 @@ class Filter {
    */
   virtual optional<float> new_value(float value) = 0;
 
+  /** Process a block of values in place, used by Sensor::publish_samples().
+   *
+   * The values this filter lets through are moved to the start of the block, in order.
+   *
+   * @param values The values, overwritten with the output values.
+   * @param count The number of values.
+   * @return The number of output values.
+   */
+  virtual size_t new_values(float *values, size_t count);
+
   /// Initialize this filter, please note this can be called more than once.
   virtual void initialize(Sensor *parent, Filter *next);
 
@@ -68,6 +80,8 @@ class QuantileFilter : public Filter {
 
  protected:
   std::deque<float> queue_;
+  /// The values in the window without NaN, kept sorted.
+  std::vector<float> sorted_;
   size_t send_every_;
   size_t send_at_;
   size_t window_size_;
@@ -97,6 +111,8 @@ class MedianFilter : public Filter {
 
  protected:
   std::deque<float> queue_;
+  /// The values in the window without NaN, kept sorted.
+  std::vector<float> sorted_;
   size_t send_every_;
   size_t send_at_;
   size_t window_size_;
@@ -142,7 +158,10 @@ class MinFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  /// Candidates for the minimum with their sequence number, the first one is the current minimum.
+  std::deque<std::pair<uint32_t, float>> candidates_;
+  /// Sequence number of the last value.
+  uint32_t count_{0};
   size_t send_every_;
   size_t send_at_;
   size_t window_size_;
@@ -170,7 +189,10 @@ class MaxFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  /// Candidates for the maximum with their sequence number, the first one is the current maximum.
+  std::deque<std::pair<uint32_t, float>> candidates_;
+  /// Sequence number of the last value.
+  uint32_t count_{0};
   size_t send_every_;
   size_t send_at_;
   size_t window_size_;
@@ -270,6 +292,107 @@ class LambdaFilter : public Filter {
   lambda_filter_t lambda_filter_;
 };
 
+/** Stateless filter stages, shared by their filters and FusedFilter.
+ *
+ * apply() changes the value in place and returns false if the value should not be passed on.
+ */
+struct OffsetStage {
+  explicit OffsetStage(float offset) : offset(offset) {}
+  bool apply(float &value) const {
+    value += this->offset;
+    return true;
+  }
+
+  float offset;
+};
+
+struct MultiplyStage {
+  explicit MultiplyStage(float multiplier) : multiplier(multiplier) {}
+  bool apply(float &value) const {
+    value *= this->multiplier;
+    return true;
+  }
+
+  float multiplier;
+};
+
+struct ClampStage {
+  ClampStage(float min, float max, bool ignore_out_of_range)
+      : min(min), max(max), ignore_out_of_range(ignore_out_of_range) {}
+  bool apply(float &value) const {
+    if (!std::isfinite(value))
+      return true;
+    if (std::isfinite(this->min) && value < this->min) {
+      value = this->min;
+      return !this->ignore_out_of_range;
+    }
+    if (std::isfinite(this->max) && value > this->max) {
+      value = this->max;
+      return !this->ignore_out_of_range;
+    }
+    return true;
+  }
+
+  float min;
+  float max;
+  bool ignore_out_of_range;
+};
+
+struct RoundStage {
+  explicit RoundStage(uint8_t precision) : multiplier(powf(10.0f, precision)) {}
+  bool apply(float &value) const {
+    if (std::isfinite(value))
+      value = roundf(this->multiplier * value) / this->multiplier;
+    return true;
+  }
+
+  float multiplier;
+};
+
+struct RoundMultipleStage {
+  explicit RoundMultipleStage(float multiple) : multiple(multiple) {}
+  bool apply(float &value) const {
+    if (std::isfinite(value))
+      value = value - remainderf(value, this->multiple);
+    return true;
+  }
+
+  float multiple;
+};
+
+/** A chain of stateless filter stages in a single filter.
+ *
+ * Generated for consecutive offset, multiply, clamp and round filters, so that they need only one filter object and
+ * one virtual call per value.
+ */
+template<typename... Stages> class FusedFilter : public Filter {
+ public:
+  explicit FusedFilter(Stages... stages) : stages_(stages...) {}
+
+  optional<float> new_value(float value) override {
+    if (!this->apply_(value, std::index_sequence_for<Stages...>{}))
+      return {};
+    return value;
+  }
+
+  size_t new_values(float *values, size_t count) override {
+    size_t out = 0;
+    for (size_t i = 0; i < count; i++) {
+      float value = values[i];
+      if (this->apply_(value, std::index_sequence_for<Stages...>{}))
+        values[out++] = value;
+    }
+    return out;
+  }
+
+ protected:
+  template<size_t... I> bool apply_(float &value, std::index_sequence<I...> /*unused*/) const {
+    return (std::get<I>(this->stages_).apply(value) && ...);
+  }
+
+  std::tuple<Stages...> stages_;
+};
+
 /// A simple filter that adds `offset` to each value it receives.
 class OffsetFilter : public Filter {
  public:
@@ -278,7 +401,7 @@ class OffsetFilter : public Filter {
   optional<float> new_value(float value) override;
 
  protected:
-  float offset_;
+  OffsetStage stage_;
 };
 
 /// A simple filter that multiplies to each value it receives by `multiplier`.
@@ -289,7 +412,7 @@ class MultiplyFilter : public Filter {
   optional<float> new_value(float value) override;
 
  protected:
-  float multiplier_;
+  MultiplyStage stage_;
 };
 
 /// A simple filter that only forwards the filter chain if it doesn't receive `value_to_filter_out`.
@@ -417,9 +540,7 @@ class ClampFilter : public Filter {
   optional<float> new_value(float value) override;
 
  protected:
-  float min_{NAN};
-  float max_{NAN};
-  bool ignore_out_of_range_;
+  ClampStage stage_;
 };
 
 class RoundFilter : public Filter {
@@ -428,7 +549,7 @@ class RoundFilter : public Filter {
   optional<float> new_value(float value) override;
 
  protected:
-  uint8_t precision_;
+  RoundStage stage_;
 };
 
 class RoundMultipleFilter : public Filter {
@@ -437,7 +558,7 @@ class RoundMultipleFilter : public Filter {
   optional<float> new_value(float value) override;
 
  protected:
-  float multiple_;
+  RoundMultipleStage stage_;
 };
 
 }  // namespace sensor
@@ -6,6 +6,9 @@ namespace sensor {
 
 static const char *const TAG = "sensor";
 
+/// Number of samples that publish_samples() runs through the filters at once.
+static const size_t SAMPLE_CHUNK_SIZE = 32;
+
 std::string state_class_to_string(StateClass state_class) {
   switch (state_class) {
     case STATE_CLASS_MEASUREMENT:
@@ -49,6 +52,41 @@ void Sensor::publish_state(float state) {
   }
 }
 
+void Sensor::publish_samples(const float *samples, size_t count) {
+  if (count == 0)
+    return;
+  for (size_t i = 0; i < count; i++)
+    this->raw_callback_.call(samples[i]);
+  this->raw_state = samples[count - 1];
+
+  ESP_LOGV(TAG, "'%s': Received %zu new states", this->name_.c_str(), count);
+
+  if (this->filter_list_ == nullptr) {
+    this->internal_send_state_to_frontend(samples[count - 1]);
+    return;
+  }
+
+  // Run the filter chain on chunks of the samples, keeping only the last value that comes out of it. Filters that
+  // output values from their own callbacks, like `or`, end up in internal_send_state_to_frontend(), which keeps the
+  // last one while the block is being published.
+  float chunk[SAMPLE_CHUNK_SIZE];
+  this->publishing_samples_ = true;
+  for (size_t offset = 0; offset < count; offset += SAMPLE_CHUNK_SIZE) {
+    size_t size = std::min(count - offset, SAMPLE_CHUNK_SIZE);
+    memcpy(chunk, samples + offset, size * sizeof(float));
+    for (Filter *filter = this->filter_list_; filter != nullptr && size != 0; filter = filter->next_)
+      size = filter->new_values(chunk, size);
+    if (size != 0)
+      this->samples_state_ = chunk[size - 1];
+  }
+  this->publishing_samples_ = false;
+  if (this->samples_state_.has_value()) {
+    float state = *this->samples_state_;
+    this->samples_state_.reset();
+    this->internal_send_state_to_frontend(state);
+  }
+}
+
 void Sensor::add_on_state_callback(std::function<void(float)> &&callback) { this->callback_.add(std::move(callback)); }
 void Sensor::add_on_raw_state_callback(std::function<void(float)> &&callback) {
   this->raw_callback_.add(std::move(callback));
@@ -88,6 +126,10 @@ float Sensor::get_raw_state() const { return this->raw_state; }
 std::string Sensor::unique_id() { return ""; }
 
 void Sensor::internal_send_state_to_frontend(float state) {
+  if (this->publishing_samples_) {
+    this->samples_state_ = state;
+    return;
+  }
   this->has_state_ = true;
   this->state = state;
   ESP_LOGD(TAG, "'%s': Sending state %.5f %s with %d decimals of accuracy", this->get_name().c_str(), state,
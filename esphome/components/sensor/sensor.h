@@ -114,6 +114,17 @@ class Sensor : public EntityBase, public EntityBase_DeviceClass, public EntityBa
    */
   void publish_state(float state);
 
+  /** Publish a block of samples, for sensors that sample faster than their state should be updated.
+   *
+   * Every sample is passed to the raw state callbacks and through all filters, but only the last value that makes it
+   * through the filters is sent to the front-end. Filters that output values later from a timeout, like `debounce`,
+   * still do so afterwards.
+   *
+   * @param samples The samples, oldest first.
+   * @param count The number of samples.
+   */
+  void publish_samples(const float *samples, size_t count);
+
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
   /// Add a callback that will be called every time a filtered value arrives.
@@ -157,6 +168,8 @@ class Sensor : public EntityBase, public EntityBase_DeviceClass, public EntityBa
   optional<StateClass> state_class_{STATE_CLASS_NONE};  ///< State class override
   bool force_update_{false};                            ///< Force update mode
   bool has_state_{false};
+  bool publishing_samples_{false};  ///< Whether publish_samples() is running the filters
+  optional<float> samples_state_;   ///< Last value that came out of the filters during publish_samples()
 };
 
 }  // namespace sensor
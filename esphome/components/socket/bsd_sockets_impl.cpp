@@ -4,6 +4,10 @@
 
 #ifdef USE_SOCKET_IMPL_BSD_SOCKETS
 
+#ifdef USE_SOCKET_POLL
+#include "esphome/core/application.h"
+#endif
+
 #include <cstring>
 
 #ifdef USE_ESP32
@@ -40,7 +44,12 @@ std::string format_sockaddr(const struct sockaddr_storage &storage) {
 
 class BSDSocketImpl : public Socket {
  public:
-  BSDSocketImpl(int fd) : fd_(fd) {}
+  BSDSocketImpl(int fd, bool loop_monitored = false) : fd_(fd), loop_monitored_(loop_monitored) {
+#ifdef USE_SOCKET_POLL
+    if (loop_monitored_)
+      App.register_socket_fd(fd_);
+#endif
+  }
   ~BSDSocketImpl() override {
     if (!closed_) {
       close();  // NOLINT(clang-analyzer-optin.cplusplus.VirtualCall)
@@ -50,10 +59,14 @@ class BSDSocketImpl : public Socket {
     int fd = ::accept(fd_, addr, addrlen);
     if (fd == -1)
       return {};
-    return make_unique<BSDSocketImpl>(fd);
+    return make_unique<BSDSocketImpl>(fd, loop_monitored_);
   }
   int bind(const struct sockaddr *addr, socklen_t addrlen) override { return ::bind(fd_, addr, addrlen); }
   int close() override {
+#ifdef USE_SOCKET_POLL
+    if (loop_monitored_)
+      App.unregister_socket_fd(fd_);
+#endif
     int ret = ::close(fd_);
     closed_ = true;
     return ret;
@@ -125,9 +138,14 @@ class BSDSocketImpl : public Socket {
     return 0;
   }
 
+#ifdef USE_SOCKET_POLL
+  bool ready() const override { return !loop_monitored_ || App.is_socket_ready(fd_); }
+#endif
+
  protected:
   int fd_;
   bool closed_ = false;
+  bool loop_monitored_;
 };
 
 std::unique_ptr<Socket> socket(int domain, int type, int protocol) {
@@ -137,6 +155,15 @@ std::unique_ptr<Socket> socket(int domain, int type, int protocol) {
   return std::unique_ptr<Socket>{new BSDSocketImpl(ret)};
 }
 
+#ifdef USE_SOCKET_POLL
+std::unique_ptr<Socket> socket_loop_monitored(int domain, int type, int protocol) {
+  int ret = ::socket(domain, type, protocol);
+  if (ret == -1)
+    return nullptr;
+  return std::unique_ptr<Socket>{new BSDSocketImpl(ret, true)};
+}
+#endif
+
 }  // namespace socket
 }  // namespace esphome
 
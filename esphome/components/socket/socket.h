@@ -42,6 +42,10 @@ class Socket {
 
   virtual int setblocking(bool blocking) = 0;
   virtual int loop() { return 0; };
+
+  /// Whether the main loop saw data (or a close) pending on this socket. Always true unless the socket is monitored
+  /// by the main loop, see socket_loop_monitored().
+  virtual bool ready() const { return true; }
 };
 
 /// Create a socket of the given domain, type and protocol.
@@ -50,6 +54,17 @@ std::unique_ptr<Socket> socket(int domain, int type, int protocol);
 /// Create a socket in the newest available IP domain (IPv6 or IPv4) of the given type and protocol.
 std::unique_ptr<Socket> socket_ip(int type, int protocol);
 
+/** Create a socket like socket(), that also wakes up the main loop when data arrives.
+ *
+ * On platforms where the main loop can wait on sockets (host) the owner can use Socket::ready() to skip reading when
+ * nothing is pending. Sockets accepted from a monitored socket are monitored too. The owner must read the socket from
+ * its loop(), otherwise the main loop will not sleep while data is pending. Elsewhere this is the same as socket().
+ */
+std::unique_ptr<Socket> socket_loop_monitored(int domain, int type, int protocol);
+
+/// Create a socket_loop_monitored() socket in the newest available IP domain (IPv6 or IPv4).
+std::unique_ptr<Socket> socket_ip_loop_monitored(int type, int protocol);
+
 /// Set a sockaddr to the specified address and port for the IP version used by socket_ip().
 socklen_t set_sockaddr(struct sockaddr *addr, socklen_t addrlen, const std::string &ip_address, uint16_t port);
 
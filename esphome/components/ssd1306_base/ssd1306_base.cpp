@@ -328,6 +328,24 @@ void HOT SSD1306::draw_absolute_pixel_internal(int x, int y, Color color) {
     this->buffer_[pos] &= ~(1 << subpos);
   }
 }
+
+void HOT SSD1306::fill_absolute_rect_internal(int x, int y, int width, int height, Color color) {
+  // Every byte of the buffer holds a column of 8 pixels of a page
+  const bool on = color.is_on();
+  for (int page = y / 8; page <= (y + height - 1) / 8; page++) {
+    const int first = std::max(y, page * 8) - page * 8;
+    const int last = std::min(y + height, page * 8 + 8) - page * 8;
+    const uint8_t bits = (0xFF >> (8 - (last - first))) << first;
+    uint8_t *pos = this->buffer_ + x + page * this->get_width_internal();
+    for (int i = 0; i < width; i++, pos++) {
+      if (on) {
+        *pos |= bits;
+      } else {
+        *pos &= ~bits;
+      }
+    }
+  }
+}
 void SSD1306::fill(Color color) {
   uint8_t fill = color.is_on() ? 0xFF : 0x00;
   for (uint32_t i = 0; i < this->get_buffer_length_(); i++)
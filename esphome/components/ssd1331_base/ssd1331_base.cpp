@@ -127,6 +127,17 @@ void HOT SSD1331::draw_absolute_pixel_internal(int x, int y, Color color) {
   this->buffer_[pos++] = (color565 >> 8) & 0xff;
   this->buffer_[pos] = color565 & 0xff;
 }
+
+void HOT SSD1331::fill_absolute_rect_internal(int x, int y, int width, int height, Color color) {
+  const uint32_t color565 = display::ColorUtil::color_to_565(color);
+  for (int row = y; row < y + height; row++) {
+    uint8_t *pos = this->buffer_ + (x + row * this->get_width_internal()) * SSD1331_BYTESPERPIXEL;
+    for (int i = 0; i < width; i++) {
+      *pos++ = (color565 >> 8) & 0xff;
+      *pos++ = color565 & 0xff;
+    }
+  }
+}
 void SSD1331::fill(Color color) {
   const uint32_t color565 = display::ColorUtil::color_to_565(color);
   for (uint32_t i = 0; i < this->get_buffer_length_(); i++) {
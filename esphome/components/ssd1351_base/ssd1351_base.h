@@ -40,6 +40,7 @@ class SSD1351 : public display::DisplayBuffer {
   void init_reset_();
 
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void fill_absolute_rect_internal(int x, int y, int width, int height, Color color) override;
 
   int get_height_internal() override;
   int get_width_internal() override;
@@ -323,6 +323,23 @@ void HOT ST7735::draw_absolute_pixel_internal(int x, int y, Color color) {
   }
 }
 
+void HOT ST7735::fill_absolute_rect_internal(int x, int y, int width, int height, Color color) {
+  if (this->eightbitcolor_) {
+    const uint8_t color332 = display::ColorUtil::color_to_332(color);
+    for (int row = y; row < y + height; row++)
+      memset(this->buffer_ + x + row * this->get_width_internal(), color332, width);
+    return;
+  }
+  const uint32_t color565 = display::ColorUtil::color_to_565(color);
+  for (int row = y; row < y + height; row++) {
+    uint8_t *pos = this->buffer_ + (x + row * this->get_width_internal()) * 2;
+    for (int i = 0; i < width; i++) {
+      *pos++ = (color565 >> 8) & 0xff;
+      *pos++ = color565 & 0xff;
+    }
+  }
+}
+
 void ST7735::init_reset_() {
   if (this->reset_pin_ != nullptr) {
     this->reset_pin_->setup();
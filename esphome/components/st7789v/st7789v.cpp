@@ -143,16 +143,24 @@ float ST7789V::get_setup_priority() const { return setup_priority::PROCESSOR; }
 
 void ST7789V::update() {
   this->do_update_();
-  this->write_display_data();
+  // Only send the changed regions of the buffer
+  for (const auto &region : this->dirty_regions_)
+    this->write_display_region_(region.x, region.y, region.w, region.h);
+  this->dirty_regions_.end_frame();
 }
 
 void ST7789V::set_model_str(const char *model_str) { this->model_str_ = model_str; }
 
 void ST7789V::write_display_data() {
-  uint16_t x1 = this->offset_height_;
-  uint16_t x2 = x1 + get_width_internal() - 1;
-  uint16_t y1 = this->offset_width_;
-  uint16_t y2 = y1 + get_height_internal() - 1;
+  this->write_display_region_(0, 0, this->get_width_internal(), this->get_height_internal());
+  this->dirty_regions_.end_frame();
+}
+
+void ST7789V::write_display_region_(int x, int y, int width, int height) {
+  uint16_t x1 = this->offset_height_ + x;
+  uint16_t x2 = x1 + width - 1;
+  uint16_t y1 = this->offset_width_ + y;
+  uint16_t y2 = y1 + height - 1;
 
   this->enable();
 
@@ -174,11 +182,11 @@ void ST7789V::write_display_data() {
   if (this->eightbitcolor_) {
     uint8_t temp_buffer[TEMP_BUFFER_SIZE];
     size_t temp_index = 0;
-    for (int line = 0; line < this->get_buffer_length_(); line = line + this->get_width_internal()) {
-      for (int index = 0; index < this->get_width_internal(); ++index) {
-        auto color = display::ColorUtil::color_to_565(
-            display::ColorUtil::to_color(this->buffer_[index + line], display::ColorOrder::COLOR_ORDER_RGB,
-                                         display::ColorBitness::COLOR_BITNESS_332, true));
+    for (int line = y; line < y + height; line++) {
+      const uint8_t *pos = this->buffer_ + x + line * this->get_width_internal();
+      for (int index = 0; index < width; ++index) {
+        auto color = display::ColorUtil::color_to_565(display::ColorUtil::to_color(
+            pos[index], display::ColorOrder::COLOR_ORDER_RGB, display::ColorBitness::COLOR_BITNESS_332, true));
         temp_buffer[temp_index++] = (uint8_t) (color >> 8);
         temp_buffer[temp_index++] = (uint8_t) color;
         if (temp_index == TEMP_BUFFER_SIZE) {
@@ -189,9 +197,14 @@ void ST7789V::write_display_data() {
     }
     if (temp_index != 0)
       this->write_array(temp_buffer, temp_index);
+  } else if (width == this->get_width_internal()) {
+    // Full rows are contiguous in the buffer
+    this->write_array(this->buffer_ + y * width * 2, height * width * 2);
   } else {
-    this->write_array(this->buffer_, this->get_buffer_length_());
+    for (int line = y; line < y + height; line++)
+      this->write_array(this->buffer_ + (x + line * this->get_width_internal()) * 2, width * 2);
   }
+  this->dirty_regions_.add_flushed_bytes(width * height * 2);
 
   this->disable();
 }
@@ -293,16 +306,54 @@ void HOT ST7789V::draw_absolute_pixel_internal(int x, int y, Color color) {
   if (x >= this->get_width_internal() || x < 0 || y >= this->get_height_internal() || y < 0)
     return;
 
+  bool updated;
   if (this->eightbitcolor_) {
     auto color332 = display::ColorUtil::color_to_332(color);
     uint32_t pos = (x + y * this->get_width_internal());
+    updated = this->buffer_[pos] != color332;
     this->buffer_[pos] = color332;
   } else {
     auto color565 = display::ColorUtil::color_to_565(color);
     uint32_t pos = (x + y * this->get_width_internal()) * 2;
+    updated = this->buffer_[pos] != ((color565 >> 8) & 0xff) || this->buffer_[pos + 1] != (color565 & 0xff);
     this->buffer_[pos++] = (color565 >> 8) & 0xff;
     this->buffer_[pos] = color565 & 0xff;
   }
+  // only the changed regions are sent to the display
+  if (updated)
+    this->dirty_regions_.add(x, y, 1, 1);
+}
+
+void HOT ST7789V::fill_absolute_rect_internal(int x, int y, int width, int height, Color color) {
+  bool updated = false;
+  if (this->eightbitcolor_) {
+    const uint8_t color332 = display::ColorUtil::color_to_332(color);
+    for (int row = y; row < y + height; row++) {
+      uint8_t *pos = this->buffer_ + x + row * this->get_width_internal();
+      for (int i = 0; i < width; i++, pos++) {
+        if (*pos != color332) {
+          *pos = color332;
+          updated = true;
+        }
+      }
+    }
+  } else {
+    const uint32_t color565 = display::ColorUtil::color_to_565(color);
+    const uint8_t high = (color565 >> 8) & 0xff;
+    const uint8_t low = color565 & 0xff;
+    for (int row = y; row < y + height; row++) {
+      uint8_t *pos = this->buffer_ + (x + row * this->get_width_internal()) * 2;
+      for (int i = 0; i < width; i++, pos += 2) {
+        if (pos[0] != high || pos[1] != low) {
+          pos[0] = high;
+          pos[1] = low;
+          updated = true;
+        }
+      }
+    }
+  }
+  if (updated)
+    this->dirty_regions_.add(x, y, width, height);
 }
 
 }  // namespace st7789v
@@ -7,11 +7,11 @@ namespace teleinfo {
 static const char *const TAG = "teleinfo";
 
 /* Helpers */
-static int get_field(char *dest, char *buf_start, char *buf_end, int sep, int max_len) {
-  char *field_end;
+static int get_field(char *dest, const char *buf_start, const char *buf_end, int sep, int max_len) {
+  const char *field_end;
   int len;
 
-  field_end = static_cast<char *>(memchr(buf_start, sep, buf_end - buf_start));
+  field_end = static_cast<const char *>(memchr(buf_start, sep, buf_end - buf_start));
   if (!field_end)
     return 0;
   len = field_end - buf_start;
@@ -41,141 +41,108 @@ bool TeleInfo::check_crc_(const char *grp, const char *grp_end) {
 
   return true;
 }
-bool TeleInfo::read_chars_until_(bool drop, uint8_t c) {
-  uint8_t received;
-  int j = 0;
-
-  while (available() > 0 && j < 128) {
-    j++;
-    received = read();
-    if (received == c)
-      return true;
-    if (drop)
-      continue;
-    /*
-     * Internal buffer is full, switch to OFF mode.
-     * Data will be retrieved on next update.
-     */
-    if (buf_index_ >= (MAX_BUF_SIZE - 1)) {
-      ESP_LOGW(TAG, "Internal buffer full");
-      state_ = OFF;
-      return false;
-    }
-    buf_[buf_index_++] = received;
-  }
-
-  return false;
+void TeleInfo::setup() {
+  state_ = OFF;
+  /* Frames start with STX (0x2) and end with ETX (0x3) */
+  this->frame_reader_.set_start_byte(0x2);
+  this->frame_reader_.set_delimiter({0x3});
+  this->frame_reader_.set_frame_callback([this](const uint8_t *frame, size_t len) {
+    if (this->state_ != ON)
+      return;
+    this->handle_frame_(reinterpret_cast<const char *>(frame) + 1, len - 2);
+    this->state_ = OFF;
+  });
+  if (!this->frame_reader_.setup())
+    this->mark_failed();
 }
-void TeleInfo::setup() { state_ = OFF; }
 void TeleInfo::update() {
-  if (state_ == OFF) {
-    buf_index_ = 0;
+  if (state_ == OFF)
     state_ = ON;
-  }
 }
-void TeleInfo::loop() {
-  switch (state_) {
-    case OFF:
-      break;
-    case ON:
-      /* Dequeue chars until start frame (0x2) */
-      if (read_chars_until_(true, 0x2))
-        state_ = START_FRAME_RECEIVED;
-      break;
-    case START_FRAME_RECEIVED:
-      /* Dequeue chars until end frame (0x3) */
-      if (read_chars_until_(false, 0x3))
-        state_ = END_FRAME_RECEIVED;
+void TeleInfo::loop() { this->frame_reader_.loop(); }
+void TeleInfo::handle_frame_(const char *buf, size_t len) {
+  const char *buf_finger = buf;
+  const char *buf_end = buf + len;
+  const char *grp_end;
+  int field_len;
+
+  /* Each frame is composed of multiple groups starting by 0xa(Line Feed) and ending by
+   * 0xd ('\r').
+   *
+   * Historical mode: each group contains tag, data and a CRC separated by 0x20 (Space)
+   * 0xa | Tag | 0x20 | Data | 0x20 | CRC | 0xd
+   *     ^^^^^^^^^^^^^^^^^^^^
+   * Checksum is computed on the above in historical mode.
+   *
+   * Standard mode: each group contains tag, data and a CRC separated by 0x9 (\t)
+   * 0xa | Tag | 0x9 | Data | 0x9 | CRC | 0xd
+   *     ^^^^^^^^^^^^^^^^^^^^^^^^^
+   * Checksum is computed on the above in standard mode.
+   *
+   * Note that some Tags may have a timestamp in Standard mode. In this case
+   * the group would looks like this:
+   * 0xa | Tag | 0x9 | Timestamp | 0x9 | Data | 0x9 | CRC | 0xd
+   *
+   * The DATE tag is a special case. The group looks like this
+   * 0xa | Tag | 0x9 | Timestamp | 0x9 | 0x9 | CRC | 0xd
+   *
+   */
+  while (buf_finger < buf_end &&
+         (buf_finger = static_cast<const char *>(memchr(buf_finger, (int) 0xa, buf_end - buf_finger)))) {
+    /*
+     * Make sure timesamp is nullified between each tag as some tags don't
+     * have a timestamp
+     */
+    timestamp_[0] = '\0';
+    /* Point to the first char of the group after 0xa */
+    buf_finger += 1;
+
+    /* Group len */
+    grp_end = static_cast<const char *>(memchr(buf_finger, 0xd, buf_end - buf_finger));
+    if (!grp_end) {
+      ESP_LOGE(TAG, "No group found");
       break;
-    case END_FRAME_RECEIVED:
-      char *buf_finger;
-      char *grp_end;
-      char *buf_end;
-      int field_len;
-
-      buf_finger = buf_;
-      buf_end = buf_ + buf_index_;
-
-      /* Each frame is composed of multiple groups starting by 0xa(Line Feed) and ending by
-       * 0xd ('\r').
-       *
-       * Historical mode: each group contains tag, data and a CRC separated by 0x20 (Space)
-       * 0xa | Tag | 0x20 | Data | 0x20 | CRC | 0xd
-       *     ^^^^^^^^^^^^^^^^^^^^
-       * Checksum is computed on the above in historical mode.
-       *
-       * Standard mode: each group contains tag, data and a CRC separated by 0x9 (\t)
-       * 0xa | Tag | 0x9 | Data | 0x9 | CRC | 0xd
-       *     ^^^^^^^^^^^^^^^^^^^^^^^^^
-       * Checksum is computed on the above in standard mode.
-       *
-       * Note that some Tags may have a timestamp in Standard mode. In this case
-       * the group would looks like this:
-       * 0xa | Tag | 0x9 | Timestamp | 0x9 | Data | 0x9 | CRC | 0xd
-       *
-       * The DATE tag is a special case. The group looks like this
-       * 0xa | Tag | 0x9 | Timestamp | 0x9 | 0x9 | CRC | 0xd
-       *
-       */
-      while ((buf_finger = static_cast<char *>(memchr(buf_finger, (int) 0xa, buf_index_ - 1))) &&
-             ((buf_finger - buf_) < buf_index_)) {  // NOLINT(clang-diagnostic-sign-compare)
-        /*
-         * Make sure timesamp is nullified between each tag as some tags don't
-         * have a timestamp
-         */
-        timestamp_[0] = '\0';
-        /* Point to the first char of the group after 0xa */
-        buf_finger += 1;
-
-        /* Group len */
-        grp_end = static_cast<char *>(memchr(buf_finger, 0xd, buf_end - buf_finger));
-        if (!grp_end) {
-          ESP_LOGE(TAG, "No group found");
-          break;
-        }
-
-        if (!check_crc_(buf_finger, grp_end))
-          continue;
-
-        /* Get tag */
-        field_len = get_field(tag_, buf_finger, grp_end, separator_, MAX_TAG_SIZE);
-        if (!field_len || field_len >= MAX_TAG_SIZE) {
-          ESP_LOGE(TAG, "Invalid tag.");
-          continue;
-        }
-
-        /* Advance buf_finger to after the tag and the separator. */
-        buf_finger += field_len + 1;
-
-        /*
-         * If there is two separators and the tag is not equal to "DATE" or
-         * historical mode is not in use (separator_ != 0x20), it means there is a
-         * timestamp to read first.
-         */
-        if (std::count(buf_finger, grp_end, separator_) == 2 && strcmp(tag_, "DATE") != 0 && separator_ != 0x20) {
-          field_len = get_field(timestamp_, buf_finger, grp_end, separator_, MAX_TIMESTAMP_SIZE);
-          if (!field_len || field_len >= MAX_TIMESTAMP_SIZE) {
-            ESP_LOGE(TAG, "Invalid timestamp for tag %s", timestamp_);
-            continue;
-          }
-
-          /* Advance buf_finger to after the first data and the separator. */
-          buf_finger += field_len + 1;
-        }
-
-        field_len = get_field(val_, buf_finger, grp_end, separator_, MAX_VAL_SIZE);
-        if (!field_len || field_len >= MAX_VAL_SIZE) {
-          ESP_LOGE(TAG, "Invalid value for tag %s", tag_);
-          continue;
-        }
-
-        /* Advance buf_finger to end of group */
-        buf_finger += field_len + 1 + 1 + 1;
-
-        publish_value_(std::string(tag_), std::string(val_));
+    }
+
+    if (!check_crc_(buf_finger, grp_end))
+      continue;
+
+    /* Get tag */
+    field_len = get_field(tag_, buf_finger, grp_end, separator_, MAX_TAG_SIZE);
+    if (!field_len || field_len >= MAX_TAG_SIZE) {
+      ESP_LOGE(TAG, "Invalid tag.");
+      continue;
+    }
+
+    /* Advance buf_finger to after the tag and the separator. */
+    buf_finger += field_len + 1;
+
+    /*
+     * If there is two separators and the tag is not equal to "DATE" or
+     * historical mode is not in use (separator_ != 0x20), it means there is a
+     * timestamp to read first.
+     */
+    if (std::count(buf_finger, grp_end, separator_) == 2 && strcmp(tag_, "DATE") != 0 && separator_ != 0x20) {
+      field_len = get_field(timestamp_, buf_finger, grp_end, separator_, MAX_TIMESTAMP_SIZE);
+      if (!field_len || field_len >= MAX_TIMESTAMP_SIZE) {
+        ESP_LOGE(TAG, "Invalid timestamp for tag %s", timestamp_);
+        continue;
       }
-      state_ = OFF;
-      break;
+
+      /* Advance buf_finger to after the first data and the separator. */
+      buf_finger += field_len + 1;
+    }
+
+    field_len = get_field(val_, buf_finger, grp_end, separator_, MAX_VAL_SIZE);
+    if (!field_len || field_len >= MAX_VAL_SIZE) {
+      ESP_LOGE(TAG, "Invalid value for tag %s", tag_);
+      continue;
+    }
+
+    /* Advance buf_finger to end of group */
+    buf_finger += field_len + 1 + 1 + 1;
+
+    publish_value_(std::string(tag_), std::string(val_));
   }
 }
 void TeleInfo::publish_value_(const std::string &tag, const std::string &val) {
@@ -2,6 +2,7 @@
 
 #include "esphome/core/component.h"
 #include "esphome/components/uart/uart.h"
+#include "esphome/components/uart/uart_frame_reader.h"
 
 #include <vector>
 
@@ -35,18 +36,15 @@ class TeleInfo : public PollingComponent, public uart::UARTDevice {
   uint32_t baud_rate_;
   int checksum_area_end_;
   int separator_;
-  char buf_[MAX_BUF_SIZE];
-  uint32_t buf_index_{0};
+  uart::UARTFrameReader frame_reader_{this, MAX_BUF_SIZE};
   char tag_[MAX_TAG_SIZE];
   char val_[MAX_VAL_SIZE];
   char timestamp_[MAX_TIMESTAMP_SIZE];
   enum State {
     OFF,
     ON,
-    START_FRAME_RECEIVED,
-    END_FRAME_RECEIVED,
   } state_{OFF};
-  bool read_chars_until_(bool drop, uint8_t c);
+  void handle_frame_(const char *buf, size_t len);
   bool check_crc_(const char *grp, const char *grp_end);
   void publish_value_(const std::string &tag, const std::string &val);
 };
@@ -0,0 +1,132 @@
+#include "uart_frame_reader.h"
+#include <algorithm>
+#include <cstring>
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace uart {
+
+static const char *const TAG = "uart.frame_reader";
+
+UARTFrameReader::UARTFrameReader(UARTDevice *device, size_t max_frame_size)
+    : device_(device), buffer_(max_frame_size) {}
+
+bool UARTFrameReader::setup() {
+  switch (this->mode_) {
+    case UART_FRAME_DELIMITER:
+      if (this->delimiter_.empty()) {
+        ESP_LOGE(TAG, "Delimiter mode needs a delimiter");
+        return false;
+      }
+      break;
+    case UART_FRAME_LENGTH:
+      if (this->length_size_ != 1 && this->length_size_ != 2) {
+        ESP_LOGE(TAG, "Length field must be 1 or 2 bytes, not %u", this->length_size_);
+        return false;
+      }
+      break;
+    case UART_FRAME_IDLE:
+    default:
+      if (this->idle_timeout_ == 0) {
+        ESP_LOGE(TAG, "Idle mode needs an idle timeout");
+        return false;
+      }
+      break;
+  }
+  return true;
+}
+
+void UARTFrameReader::loop() {
+  const uint32_t now = millis();
+  int available = this->device_->available();
+  if (available <= 0) {
+    // Only time out once nothing is waiting, after a late loop the rest of the frame may already be buffered
+    if (this->size_ != 0 && this->idle_timeout_ != 0 && now - this->last_byte_ >= this->idle_timeout_) {
+      if (this->mode_ == UART_FRAME_IDLE) {
+        this->deliver_(this->size_);
+      } else {
+        ESP_LOGV(TAG, "Dropping %zu bytes of an incomplete frame", this->size_);
+        this->reset();
+      }
+    }
+    return;
+  }
+  this->last_byte_ = now;
+
+  while (available > 0) {
+    if (this->size_ == this->buffer_.size()) {
+      ESP_LOGW(TAG, "Frame larger than %zu bytes, dropping it", this->buffer_.size());
+      this->reset();
+    }
+    size_t len = std::min<size_t>(available, this->buffer_.size() - this->size_);
+    if (!this->device_->read_array(this->buffer_.data() + this->size_, len)) {
+      this->reset();
+      return;
+    }
+    available -= len;
+    this->size_ += len;
+
+    while (this->size_ != 0) {
+      if (this->start_byte_.has_value() && this->buffer_[0] != *this->start_byte_) {
+        // Drop everything before the start of the next frame
+        auto start = std::find(this->buffer_.begin(), this->buffer_.begin() + this->size_, *this->start_byte_);
+        size_t skip = start - this->buffer_.begin();
+        memmove(this->buffer_.data(), this->buffer_.data() + skip, this->size_ - skip);
+        this->size_ -= skip;
+        this->scanned_ = 0;
+        continue;
+      }
+      size_t frame_size = this->frame_size_();
+      if (frame_size == 0)
+        break;
+      this->deliver_(frame_size);
+    }
+  }
+}
+
+size_t UARTFrameReader::frame_size_() {
+  switch (this->mode_) {
+    case UART_FRAME_DELIMITER: {
+      if (this->delimiter_.empty())
+        return 0;
+      // The delimiter may have been split over two reads
+      size_t from = std::max(this->scanned_, this->delimiter_.size() - 1) - (this->delimiter_.size() - 1);
+      auto begin = this->buffer_.begin() + from;
+      auto end = this->buffer_.begin() + this->size_;
+      auto it = std::search(begin, end, this->delimiter_.begin(), this->delimiter_.end());
+      if (it == end) {
+        this->scanned_ = this->size_;
+        return 0;
+      }
+      return it - this->buffer_.begin() + this->delimiter_.size();
+    }
+    case UART_FRAME_LENGTH: {
+      size_t header_size = this->length_offset_ + this->length_size_;
+      if (this->size_ < header_size)
+        return 0;
+      const uint8_t *field = this->buffer_.data() + this->length_offset_;
+      size_t length = field[0];
+      if (this->length_size_ == 2)
+        length = this->length_big_endian_ ? encode_uint16(field[0], field[1]) : encode_uint16(field[1], field[0]);
+      length = std::max(length + this->length_adjust_, header_size);
+      return this->size_ >= length ? length : 0;
+    }
+    case UART_FRAME_IDLE:
+    default:
+      return 0;
+  }
+}
+
+void UARTFrameReader::deliver_(size_t size) {
+  if (this->frame_callback_)
+    this->frame_callback_(this->buffer_.data(), size);
+  // The callback may have reset the reader
+  size = std::min(size, this->size_);
+  memmove(this->buffer_.data(), this->buffer_.data() + size, this->size_ - size);
+  this->size_ -= size;
+  this->scanned_ = 0;
+}
+
+}  // namespace uart
+}  // namespace esphome
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+#include "esphome/core/helpers.h"
+#include "uart.h"
+
+namespace esphome {
+namespace uart {
+
+/// How the UARTFrameReader finds the end of a frame.
+enum UARTFrameMode {
+  /// A frame ends with the delimiter sequence.
+  UART_FRAME_DELIMITER,
+  /// A frame has a length field at a fixed offset.
+  UART_FRAME_LENGTH,
+  /// A frame ends when no byte has been received for the idle timeout, which has to be set.
+  UART_FRAME_IDLE,
+};
+
+/** Splits the bytes received on a UART bus into frames for a protocol driver.
+ *
+ * Instead of polling available() and read_byte() for every byte, call loop() from the driver's loop(). It reads all
+ * available bytes at once and calls the frame callback with every complete frame, including its delimiters.
+ *
+ * With an idle timeout in delimiter or length mode, the bytes of an incomplete frame are dropped once the line has
+ * been idle for that long. Frames that don't fit in the buffer are dropped as well.
+ *
+ * The idle timeout is only checked in loop() calls that find no bytes waiting, against the loop() call that last
+ * found some, so it can't be shorter than the main loop interval. It is meant for gaps between messages, not for
+ * inter-frame timing at the scale of a few characters like Modbus RTU needs.
+ */
+class UARTFrameReader {
+ public:
+  UARTFrameReader(UARTDevice *device, size_t max_frame_size);
+
+  /// Frames end with this byte sequence.
+  void set_delimiter(std::vector<uint8_t> delimiter) {
+    this->mode_ = UART_FRAME_DELIMITER;
+    this->delimiter_ = std::move(delimiter);
+  }
+  /** Frames have a length field.
+   *
+   * @param offset Position of the length field in the frame.
+   * @param size Size of the length field in bytes, 1 or 2.
+   * @param adjust Number of bytes of the frame that are not counted by the length field.
+   * @param big_endian Whether a 2 byte length field is big endian.
+   */
+  void set_length_field(size_t offset, uint8_t size, size_t adjust, bool big_endian = true) {
+    this->mode_ = UART_FRAME_LENGTH;
+    this->length_offset_ = offset;
+    this->length_size_ = size;
+    this->length_adjust_ = adjust;
+    this->length_big_endian_ = big_endian;
+  }
+  /// Frames start with this byte, everything before it is dropped.
+  void set_start_byte(uint8_t start_byte) { this->start_byte_ = start_byte; }
+  /// Maximum time between two bytes of a frame in ms, frames end on it when no delimiter or length field is set.
+  void set_idle_timeout(uint32_t idle_timeout) { this->idle_timeout_ = idle_timeout; }
+  void set_frame_callback(std::function<void(const uint8_t *, size_t)> &&callback) {
+    this->frame_callback_ = std::move(callback);
+  }
+
+  /** Check the configuration, call it from the driver's setup() after configuring the reader.
+   *
+   * @return false if the reader can never find the end of a frame, e.g. idle mode without an idle timeout.
+   */
+  bool setup();
+  /// Read all available bytes and deliver the complete frames.
+  void loop();
+  /// Drop all buffered bytes.
+  void reset() {
+    this->size_ = 0;
+    this->scanned_ = 0;
+  }
+
+ protected:
+  /// Return the size of the frame at the start of the buffer, or 0 if it isn't complete yet.
+  size_t frame_size_();
+  void deliver_(size_t size);
+
+  UARTDevice *device_;
+  std::vector<uint8_t> buffer_;
+  size_t size_{0};
+  /// Position up to which the buffer was already searched for the delimiter.
+  size_t scanned_{0};
+  UARTFrameMode mode_{UART_FRAME_IDLE};
+  std::vector<uint8_t> delimiter_;
+  optional<uint8_t> start_byte_;
+  size_t length_offset_{0};
+  size_t length_adjust_{0};
+  uint8_t length_size_{1};
+  bool length_big_endian_{true};
+  uint32_t idle_timeout_{0};
+  uint32_t last_byte_{0};
+  std::function<void(const uint8_t *, size_t)> frame_callback_;
+};
+
+}  // namespace uart
+}  // namespace esphome
@@ -33,6 +33,8 @@ from esphome.core import CORE, coroutine_with_priority
 
 AUTO_LOAD = ["json", "web_server_base"]
 
+CONF_EVENTS_INTERVAL = "events_interval"
+
 web_server_ns = cg.esphome_ns.namespace("web_server")
 WebServer = web_server_ns.class_("WebServer", cg.Component, cg.Controller)
 
@@ -134,6 +136,9 @@ CONFIG_SCHEMA = cv.All(
                 web_server_base.WebServerBase
             ),
             cv.Optional(CONF_INCLUDE_INTERNAL, default=False): cv.boolean,
+            cv.Optional(
+                CONF_EVENTS_INTERVAL, default="0ms"
+            ): cv.positive_time_period_milliseconds,
             cv.SplitDefault(
                 CONF_OTA,
                 esp8266=True,
@@ -239,5 +244,6 @@ async def to_code(config):
         with open(file=path, encoding="utf-8") as js_file:
             add_resource_as_progmem("JS_INCLUDE", js_file.read())
     cg.add(var.set_include_internal(config[CONF_INCLUDE_INTERNAL]))
+    cg.add(var.set_events_interval(config[CONF_EVENTS_INTERVAL]))
     if CONF_LOCAL in config and config[CONF_LOCAL]:
         cg.add_define("USE_WEBSERVER_LOCAL")
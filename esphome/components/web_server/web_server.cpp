@@ -1,6 +1,6 @@
 #include "web_server.h"
 
-#include "esphome/components/json/json_util.h"
+#include "esphome/components/json/json_writer.h"
 #include "esphome/components/network/util.h"
 #include "esphome/core/application.h"
 #include "esphome/core/entity_base.h"
@@ -38,6 +38,8 @@ namespace esphome {
 namespace web_server {
 
 static const char *const TAG = "web_server";
+/// Longest time in ms that states are held back for event source clients that are still busy.
+static const uint32_t EVENTS_MAX_HOLD_TIME = 1000;
 
 #ifdef USE_WEBSERVER_PRIVATE_NETWORK_ACCESS
 static const char *const HEADER_PNA_NAME = "Private-Network-Access-Name";
@@ -87,23 +89,27 @@ void WebServer::set_js_include(const char *js_include) { this->js_include_ = js_
 #endif
 
 std::string WebServer::get_config_json() {
-  return json::build_json([this](JsonObject root) {
-    root["title"] = App.get_friendly_name().empty() ? App.get_name() : App.get_friendly_name();
-    root["comment"] = App.get_comment();
-    root["ota"] = this->allow_ota_;
-    root["log"] = this->expose_log_;
-    root["lang"] = "en";
-  });
+  std::string output;
+  json::JsonWriter root(output);
+  root.begin_object();
+  root.add("title", App.get_friendly_name().empty() ? App.get_name() : App.get_friendly_name());
+  root.add("comment", App.get_comment());
+  root.add("ota", this->allow_ota_);
+  root.add("log", this->expose_log_);
+  root.add("lang", "en");
+  root.end_object();
+  return output;
 }
 
 void WebServer::setup() {
   ESP_LOGCONFIG(TAG, "Setting up web server...");
   this->setup_controller(this->include_internal_);
   this->base_->init();
+  this->config_json_ = this->get_config_json();
 
   this->events_.onConnect([this](AsyncEventSourceClient *client) {
     // Configure reconnect timeout and send config
-    client->send(this->get_config_json().c_str(), "ping", millis(), 30000);
+    client->send(this->config_json_.c_str(), "ping", millis(), 30000);
 
     this->entities_iterator_.begin(this->include_internal_);
   });
@@ -120,9 +126,69 @@ void WebServer::setup() {
   if (this->allow_ota_)
     this->base_->add_ota_handler();
 
-  this->set_interval(10000, [this]() { this->events_.send("", "ping", millis(), 30000); });
+  this->set_interval(10000, [this]() {
+    this->events_.send("", "ping", millis(), 30000);
+    ESP_LOGV(TAG, "Event source: %u clients, %u events queued per client on average", this->events_.count(),
+             this->events_.avgPacketsWaiting());
+  });
+}
+void WebServer::push_state_json_(EntityBase *obj, std::function<std::string()> &&build) {
+  {
+    LockGuard guard(this->state_json_lock_);
+    this->state_json_cache_.erase(obj);
+  }
+  if (this->events_.count() == 0)
+    return;
+  for (auto &pending : this->pending_states_) {
+    if (pending.first == obj) {
+      pending.second = std::move(build);
+      return;
+    }
+  }
+  this->pending_states_.emplace_back(obj, std::move(build));
+}
+void WebServer::flush_state_json_() {
+  if (this->pending_states_.empty())
+    return;
+  const uint32_t now = millis();
+  const uint32_t since_push = now - this->last_events_push_;
+  if (since_push < this->events_interval_)
+    return;
+  // Hold the states back while the clients haven't sent the previous events yet, but not forever so that one stuck
+  // client doesn't stall the others.
+  if (this->events_.avgPacketsWaiting() != 0 && since_push < EVENTS_MAX_HOLD_TIME)
+    return;
+  if (this->events_.count() != 0) {
+    for (auto &pending : this->pending_states_) {
+      std::string data = pending.second();
+      this->events_.send(data.c_str(), "state");
+      if (!this->tracks_state_(pending.first))
+        continue;
+      LockGuard guard(this->state_json_lock_);
+      this->state_json_cache_[pending.first] = std::move(data);
+    }
+  }
+  this->pending_states_.clear();
+  this->last_events_push_ = now;
+}
+bool WebServer::tracks_state_(EntityBase *obj) const {
+  // setup_controller() only registers state callbacks for internal entities with include_internal
+  return this->include_internal_ || !obj->is_internal();
+}
+std::string WebServer::get_state_json_(EntityBase *obj, const std::function<std::string()> &build) {
+  if (!this->tracks_state_(obj))
+    return build();
+  LockGuard guard(this->state_json_lock_);
+  auto it = this->state_json_cache_.find(obj);
+  if (it == this->state_json_cache_.end())
+    it = this->state_json_cache_.emplace(obj, build()).first;
+  return it->second;
 }
 void WebServer::loop() {
+#ifdef USE_ESP_IDF
+  this->events_.loop();
+#endif
+  this->flush_state_json_();
 #ifdef USE_ESP32
   if (xSemaphoreTake(this->to_schedule_lock_, 0L)) {
     std::function<void()> fn;
@@ -191,73 +257,75 @@ void WebServer::handle_js_request(AsyncWebServerRequest *request) {
 }
 #endif
 
-#define set_json_id(root, obj, sensor, start_config) \
-  (root)["id"] = sensor; \
-  if (((start_config) == DETAIL_ALL)) { \
-    (root)["name"] = (obj)->get_name(); \
-    (root)["icon"] = (obj)->get_icon(); \
-    (root)["entity_category"] = (obj)->get_entity_category(); \
-    if ((obj)->is_disabled_by_default()) \
-      (root)["is_disabled_by_default"] = (obj)->is_disabled_by_default(); \
+static void set_json_id(json::JsonWriter &root, EntityBase *obj, const std::string &id, JsonDetail start_config) {
+  root.add("id", id);
+  if (start_config == DETAIL_ALL) {
+    root.add("name", obj->get_name());
+    root.add("icon", obj->get_icon());
+    root.add("entity_category", obj->get_entity_category());
+    if (obj->is_disabled_by_default())
+      root.add("is_disabled_by_default", true);
   }
+}
 
-#define set_json_value(root, obj, sensor, value, start_config) \
-  set_json_id((root), (obj), sensor, start_config); \
-  (root)["value"] = value;
-
-#define set_json_icon_state_value(root, obj, sensor, state, value, start_config) \
-  set_json_value(root, obj, sensor, value, start_config); \
-  (root)["state"] = state;
+template<typename S, typename T>
+static void set_json_icon_state_value(json::JsonWriter &root, EntityBase *obj, const std::string &id, const S &state,
+                                      const T &value, JsonDetail start_config) {
+  set_json_id(root, obj, id, start_config);
+  root.add("value", value);
+  root.add("state", state);
+}
 
 #ifdef USE_SENSOR
 void WebServer::on_sensor_update(sensor::Sensor *obj, float state) {
-  if (this->events_.count() == 0)
-    return;
-  this->events_.send(this->sensor_json(obj, state, DETAIL_STATE).c_str(), "state");
+  this->push_state_json_(obj, [this, obj, state]() { return this->sensor_json(obj, state, DETAIL_STATE); });
 }
 void WebServer::handle_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (sensor::Sensor *obj : App.get_sensors()) {
     if (obj->get_object_id() != match.id)
       continue;
-    std::string data = this->sensor_json(obj, obj->state, DETAIL_STATE);
+    std::string data =
+        this->get_state_json_(obj, [this, obj]() { return this->sensor_json(obj, obj->state, DETAIL_STATE); });
     request->send(200, "application/json", data.c_str());
     return;
   }
   request->send(404);
 }
 std::string WebServer::sensor_json(sensor::Sensor *obj, float value, JsonDetail start_config) {
-  return json::build_json([this, obj, value, start_config](JsonObject root) {
-    std::string state;
-    if (std::isnan(value)) {
-      state = "NA";
-    } else {
-      state = value_accuracy_to_string(value, obj->get_accuracy_decimals());
-      if (!obj->get_unit_of_measurement().empty())
-        state += " " + obj->get_unit_of_measurement();
-    }
-    set_json_icon_state_value(root, obj, "sensor-" + obj->get_object_id(), state, value, start_config);
-    if (start_config == DETAIL_ALL) {
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-      }
-      if (!obj->get_unit_of_measurement().empty())
-        root["uom"] = obj->get_unit_of_measurement();
+  std::string output;
+  json::JsonWriter root(output);
+  root.begin_object();
+  std::string state;
+  if (std::isnan(value)) {
+    state = "NA";
+  } else {
+    state = value_accuracy_to_string(value, obj->get_accuracy_decimals());
+    if (!obj->get_unit_of_measurement().empty())
+      state += " " + obj->get_unit_of_measurement();
+  }
+  set_json_icon_state_value(root, obj, "sensor-" + obj->get_object_id(), state, value, start_config);
+  if (start_config == DETAIL_ALL) {
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      root.add("sorting_weight", this->sorting_entitys_[obj].weight);
     }
-  });
+    if (!obj->get_unit_of_measurement().empty())
+      root.add("uom", obj->get_unit_of_measurement());
+  }
+  root.end_object();
+  return output;
 }
 #endif
 
 #ifdef USE_TEXT_SENSOR
 void WebServer::on_text_sensor_update(text_sensor::TextSensor *obj, const std::string &state) {
-  if (this->events_.count() == 0)
-    return;
-  this->events_.send(this->text_sensor_json(obj, state, DETAIL_STATE).c_str(), "state");
+  this->push_state_json_(obj, [this, obj, state]() { return this->text_sensor_json(obj, state, DETAIL_STATE); });
 }
 void WebServer::handle_text_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (text_sensor::TextSensor *obj : App.get_text_sensors()) {
     if (obj->get_object_id() != match.id)
       continue;
-    std::string data = this->text_sensor_json(obj, obj->state, DETAIL_STATE);
+    std::string data =
+        this->get_state_json_(obj, [this, obj]() { return this->text_sensor_json(obj, obj->state, DETAIL_STATE); });
     request->send(200, "application/json", data.c_str());
     return;
   }
@@ -265,22 +333,23 @@ void WebServer::handle_text_sensor_request(AsyncWebServerRequest *request, const
 }
 std::string WebServer::text_sensor_json(text_sensor::TextSensor *obj, const std::string &value,
                                         JsonDetail start_config) {
-  return json::build_json([this, obj, value, start_config](JsonObject root) {
-    set_json_icon_state_value(root, obj, "text_sensor-" + obj->get_object_id(), value, value, start_config);
-    if (start_config == DETAIL_ALL) {
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-      }
+  std::string output;
+  json::JsonWriter root(output);
+  root.begin_object();
+  set_json_icon_state_value(root, obj, "text_sensor-" + obj->get_object_id(), value, value, start_config);
+  if (start_config == DETAIL_ALL) {
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      root.add("sorting_weight", this->sorting_entitys_[obj].weight);
     }
-  });
+  }
+  root.end_object();
+  return output;
 }
 #endif
 
 #ifdef USE_SWITCH
 void WebServer::on_switch_update(switch_::Switch *obj, bool state) {
-  if (this->events_.count() == 0)
-    return;
-  this->events_.send(this->switch_json(obj, state, DETAIL_STATE).c_str(), "state");
+  this->push_state_json_(obj, [this, obj, state]() { return this->switch_json(obj, state, DETAIL_STATE); });
 }
 void WebServer::handle_switch_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (switch_::Switch *obj : App.get_switches()) {
@@ -288,7 +357,8 @@ void WebServer::handle_switch_request(AsyncWebServerRequest *request, const UrlM
       continue;
 
     if (request->method() == HTTP_GET && match.method.empty()) {
-      std::string data = this->switch_json(obj, obj->state, DETAIL_STATE);
+      std::string data =
+          this->get_state_json_(obj, [this, obj]() { return this->switch_json(obj, obj->state, DETAIL_STATE); });
       request->send(200, "application/json", data.c_str());
     } else if (match.method == "toggle") {
       this->schedule_([obj]() { obj->toggle(); });
@@ -307,15 +377,18 @@ void WebServer::handle_switch_request(AsyncWebServerRequest *request, const UrlM
   request->send(404);
 }
 std::string WebServer::switch_json(switch_::Switch *obj, bool value, JsonDetail start_config) {
-  return json::build_json([this, obj, value, start_config](JsonObject root) {
-    set_json_icon_state_value(root, obj, "switch-" + obj->get_object_id(), value ? "ON" : "OFF", value, start_config);
-    if (start_config == DETAIL_ALL) {
-      root["assumed_state"] = obj->assumed_state();
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-      }
+  std::string output;
+  json::JsonWriter root(output);
+  root.begin_object();
+  set_json_icon_state_value(root, obj, "switch-" + obj->get_object_id(), value ? "ON" : "OFF", value, start_config);
+  if (start_config == DETAIL_ALL) {
+    root.add("assumed_state", obj->assumed_state());
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      root.add("sorting_weight", this->sorting_entitys_[obj].weight);
     }
-  });
+  }
+  root.end_object();
+  return output;
 }
 #endif
 
@@ -336,51 +409,54 @@ void WebServer::handle_button_request(AsyncWebServerRequest *request, const UrlM
   request->send(404);
 }
 std::string WebServer::button_json(button::Button *obj, JsonDetail start_config) {
-  return json::build_json([this, obj, start_config](JsonObject root) {
-    set_json_id(root, obj, "button-" + obj->get_object_id(), start_config);
-    if (start_config == DETAIL_ALL) {
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-      }
+  std::string output;
+  json::JsonWriter root(output);
+  root.begin_object();
+  set_json_id(root, obj, "button-" + obj->get_object_id(), start_config);
+  if (start_config == DETAIL_ALL) {
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      root.add("sorting_weight", this->sorting_entitys_[obj].weight);
     }
-  });
+  }
+  root.end_object();
+  return output;
 }
 #endif
 
 #ifdef USE_BINARY_SENSOR
 void WebServer::on_binary_sensor_update(binary_sensor::BinarySensor *obj, bool state) {
-  if (this->events_.count() == 0)
-    return;
-  this->events_.send(this->binary_sensor_json(obj, state, DETAIL_STATE).c_str(), "state");
+  this->push_state_json_(obj, [this, obj, state]() { return this->binary_sensor_json(obj, state, DETAIL_STATE); });
 }
 void WebServer::handle_binary_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (binary_sensor::BinarySensor *obj : App.get_binary_sensors()) {
     if (obj->get_object_id() != match.id)
       continue;
-    std::string data = this->binary_sensor_json(obj, obj->state, DETAIL_STATE);
+    std::string data =
+        this->get_state_json_(obj, [this, obj]() { return this->binary_sensor_json(obj, obj->state, DETAIL_STATE); });
     request->send(200, "application/json", data.c_str());
     return;
   }
   request->send(404);
 }
 std::string WebServer::binary_sensor_json(binary_sensor::BinarySensor *obj, bool value, JsonDetail start_config) {
-  return json::build_json([this, obj, value, start_config](JsonObject root) {
-    set_json_icon_state_value(root, obj, "binary_sensor-" + obj->get_object_id(), value ? "ON" : "OFF", value,
-                              start_config);
-    if (start_config == DETAIL_ALL) {
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-      }
+  std::string output;
+  json::JsonWriter root(output);
+  root.begin_object();
+  set_json_icon_state_value(root, obj, "binary_sensor-" + obj->get_object_id(), value ? "ON" : "OFF", value,
+                            start_config);
+  if (start_config == DETAIL_ALL) {
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      root.add("sorting_weight", this->sorting_entitys_[obj].weight);
     }
-  });
+  }
+  root.end_object();
+  return output;
 }
 #endif
 
 #ifdef USE_FAN
 void WebServer::on_fan_update(fan::Fan *obj) {
-  if (this->events_.count() == 0)
-    return;
-  this->events_.send(this->fan_json(obj, DETAIL_STATE).c_str(), "state");
+  this->push_state_json_(obj, [this, obj]() { return this->fan_json(obj, DETAIL_STATE); });
 }
 void WebServer::handle_fan_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (fan::Fan *obj : App.get_fans()) {
@@ -388,7 +464,7 @@ void WebServer::handle_fan_request(AsyncWebServerRequest *request, const UrlMatc
       continue;
 
     if (request->method() == HTTP_GET && match.method.empty()) {
-      std::string data = this->fan_json(obj, DETAIL_STATE);
+      std::string data = this->get_state_json_(obj, [this, obj]() { return this->fan_json(obj, DETAIL_STATE); });
       request->send(200, "application/json", data.c_str());
     } else if (match.method == "toggle") {
       this->schedule_([obj]() { obj->toggle().perform(); });
@@ -435,30 +511,31 @@ void WebServer::handle_fan_request(AsyncWebServerRequest *request, const UrlMatc
   request->send(404);
 }
 std::string WebServer::fan_json(fan::Fan *obj, JsonDetail start_config) {
-  return json::build_json([this, obj, start_config](JsonObject root) {
-    set_json_icon_state_value(root, obj, "fan-" + obj->get_object_id(), obj->state ? "ON" : "OFF", obj->state,
-                              start_config);
-    const auto traits = obj->get_traits();
-    if (traits.supports_speed()) {
-      root["speed_level"] = obj->speed;
-      root["speed_count"] = traits.supported_speed_count();
-    }
-    if (obj->get_traits().supports_oscillation())
-      root["oscillation"] = obj->oscillating;
-    if (start_config == DETAIL_ALL) {
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-      }
+  std::string output;
+  json::JsonWriter root(output);
+  root.begin_object();
+  set_json_icon_state_value(root, obj, "fan-" + obj->get_object_id(), obj->state ? "ON" : "OFF", obj->state,
+                            start_config);
+  const auto traits = obj->get_traits();
+  if (traits.supports_speed()) {
+    root.add("speed_level", obj->speed);
+    root.add("speed_count", traits.supported_speed_count());
+  }
+  if (obj->get_traits().supports_oscillation())
+    root.add("oscillation", obj->oscillating);
+  if (start_config == DETAIL_ALL) {
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      root.add("sorting_weight", this->sorting_entitys_[obj].weight);
     }
-  });
+  }
+  root.end_object();
+  return output;
 }
 #endif
 
 #ifdef USE_LIGHT
 void WebServer::on_light_update(light::LightState *obj) {
-  if (this->events_.count() == 0)
-    return;
-  this->events_.send(this->light_json(obj, DETAIL_STATE).c_str(), "state");
+  this->push_state_json_(obj, [this, obj]() { return this->light_json(obj, DETAIL_STATE); });
 }
 void WebServer::handle_light_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (light::LightState *obj : App.get_lights()) {
@@ -466,7 +543,7 @@ void WebServer::handle_light_request(AsyncWebServerRequest *request, const UrlMa
       continue;
 
     if (request->method() == HTTP_GET && match.method.empty()) {
-      std::string data = this->light_json(obj, DETAIL_STATE);
+      std::string data = this->get_state_json_(obj, [this, obj]() { return this->light_json(obj, DETAIL_STATE); });
       request->send(200, "application/json", data.c_str());
     } else if (match.method == "toggle") {
       this->schedule_([obj]() { obj->toggle().perform(); });
@@ -546,30 +623,33 @@ void WebServer::handle_light_request(AsyncWebServerRequest *request, const UrlMa
   request->send(404);
 }
 std::string WebServer::light_json(light::LightState *obj, JsonDetail start_config) {
-  return json::build_json([this, obj, start_config](JsonObject root) {
-    set_json_id(root, obj, "light-" + obj->get_object_id(), start_config);
-    root["state"] = obj->remote_values.is_on() ? "ON" : "OFF";
-
-    light::LightJSONSchema::dump_json(*obj, root);
-    if (start_config == DETAIL_ALL) {
-      JsonArray opt = root.createNestedArray("effects");
-      opt.add("None");
-      for (auto const &option : obj->get_effects()) {
-        opt.add(option->get_name());
-      }
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-      }
+  std::string output;
+  json::JsonWriter root(output);
+  root.begin_object();
+  set_json_id(root, obj, "light-" + obj->get_object_id(), start_config);
+  light::LightJSONSchema::dump_json(*obj, root);
+  // dump_json() only includes the state when the color mode can be switched on and off
+  if (!(obj->remote_values.get_color_mode() & light::ColorCapability::ON_OFF))
+    root.add("state", obj->remote_values.is_on() ? "ON" : "OFF");
+  if (start_config == DETAIL_ALL) {
+    root.begin_array("effects");
+    root.value("None");
+    for (auto const &option : obj->get_effects()) {
+      root.value(option->get_name());
+    }
+    root.end_array();
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      root.add("sorting_weight", this->sorting_entitys_[obj].weight);
     }
-  });
+  }
+  root.end_object();
+  return output;
 }
 #endif
 
 #ifdef USE_COVER
 void WebServer::on_cover_update(cover::Cover *obj) {
-  if (this->events_.count() == 0)
-    return;
-  this->events_.send(this->cover_json(obj, DETAIL_STATE).c_str(), "state");
+  this->push_state_json_(obj, [this, obj]() { return this->cover_json(obj, DETAIL_STATE); });
 }
 void WebServer::handle_cover_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (cover::Cover *obj : App.get_covers()) {
@@ -577,7 +657,7 @@ void WebServer::handle_cover_request(AsyncWebServerRequest *request, const UrlMa
       continue;
 
     if (request->method() == HTTP_GET && match.method.empty()) {
-      std::string data = this->cover_json(obj, DETAIL_STATE);
+      std::string data = this->get_state_json_(obj, [this, obj]() { return this->cover_json(obj, DETAIL_STATE); });
       request->send(200, "application/json", data.c_str());
       continue;
     }
@@ -623,29 +703,30 @@ void WebServer::handle_cover_request(AsyncWebServerRequest *request, const UrlMa
   request->send(404);
 }
 std::string WebServer::cover_json(cover::Cover *obj, JsonDetail start_config) {
-  return json::build_json([this, obj, start_config](JsonObject root) {
-    set_json_icon_state_value(root, obj, "cover-" + obj->get_object_id(), obj->is_fully_closed() ? "CLOSED" : "OPEN",
-                              obj->position, start_config);
-    root["current_operation"] = cover::cover_operation_to_str(obj->current_operation);
-
-    if (obj->get_traits().get_supports_position())
-      root["position"] = obj->position;
-    if (obj->get_traits().get_supports_tilt())
-      root["tilt"] = obj->tilt;
-    if (start_config == DETAIL_ALL) {
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-      }
+  std::string output;
+  json::JsonWriter root(output);
+  root.begin_object();
+  set_json_icon_state_value(root, obj, "cover-" + obj->get_object_id(), obj->is_fully_closed() ? "CLOSED" : "OPEN",
+                            obj->position, start_config);
+  root.add("current_operation", cover::cover_operation_to_str(obj->current_operation));
+
+  if (obj->get_traits().get_supports_position())
+    root.add("position", obj->position);
+  if (obj->get_traits().get_supports_tilt())
+    root.add("tilt", obj->tilt);
+  if (start_config == DETAIL_ALL) {
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      root.add("sorting_weight", this->sorting_entitys_[obj].weight);
     }
-  });
+  }
+  root.end_object();
+  return output;
 }
 #endif
 
 #ifdef USE_NUMBER
 void WebServer::on_number_update(number::Number *obj, float state) {
-  if (this->events_.count() == 0)
-    return;
-  this->events_.send(this->number_json(obj, state, DETAIL_STATE).c_str(), "state");
+  this->push_state_json_(obj, [this, obj, state]() { return this->number_json(obj, state, DETAIL_STATE); });
 }
 void WebServer::handle_number_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (auto *obj : App.get_numbers()) {
@@ -653,7 +734,8 @@ void WebServer::handle_number_request(AsyncWebServerRequest *request, const UrlM
       continue;
 
     if (request->method() == HTTP_GET && match.method.empty()) {
-      std::string data = this->number_json(obj, obj->state, DETAIL_STATE);
+      std::string data =
+          this->get_state_json_(obj, [this, obj]() { return this->number_json(obj, obj->state, DETAIL_STATE); });
       request->send(200, "application/json", data.c_str());
       return;
     }
@@ -677,48 +759,49 @@ void WebServer::handle_number_request(AsyncWebServerRequest *request, const UrlM
 }
 
 std::string WebServer::number_json(number::Number *obj, float value, JsonDetail start_config) {
-  return json::build_json([this, obj, value, start_config](JsonObject root) {
-    set_json_id(root, obj, "number-" + obj->get_object_id(), start_config);
-    if (start_config == DETAIL_ALL) {
-      root["min_value"] =
-          value_accuracy_to_string(obj->traits.get_min_value(), step_to_accuracy_decimals(obj->traits.get_step()));
-      root["max_value"] =
-          value_accuracy_to_string(obj->traits.get_max_value(), step_to_accuracy_decimals(obj->traits.get_step()));
-      root["step"] =
-          value_accuracy_to_string(obj->traits.get_step(), step_to_accuracy_decimals(obj->traits.get_step()));
-      root["mode"] = (int) obj->traits.get_mode();
-      if (!obj->traits.get_unit_of_measurement().empty())
-        root["uom"] = obj->traits.get_unit_of_measurement();
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-      }
-    }
-    if (std::isnan(value)) {
-      root["value"] = "\"NaN\"";
-      root["state"] = "NA";
-    } else {
-      root["value"] = value_accuracy_to_string(value, step_to_accuracy_decimals(obj->traits.get_step()));
-      std::string state = value_accuracy_to_string(value, step_to_accuracy_decimals(obj->traits.get_step()));
-      if (!obj->traits.get_unit_of_measurement().empty())
-        state += " " + obj->traits.get_unit_of_measurement();
-      root["state"] = state;
+  std::string output;
+  json::JsonWriter root(output);
+  root.begin_object();
+  set_json_id(root, obj, "number-" + obj->get_object_id(), start_config);
+  if (start_config == DETAIL_ALL) {
+    root.add("min_value",
+             value_accuracy_to_string(obj->traits.get_min_value(), step_to_accuracy_decimals(obj->traits.get_step())));
+    root.add("max_value",
+             value_accuracy_to_string(obj->traits.get_max_value(), step_to_accuracy_decimals(obj->traits.get_step())));
+    root.add("step",
+             value_accuracy_to_string(obj->traits.get_step(), step_to_accuracy_decimals(obj->traits.get_step())));
+    root.add("mode", (int) obj->traits.get_mode());
+    if (!obj->traits.get_unit_of_measurement().empty())
+      root.add("uom", obj->traits.get_unit_of_measurement());
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      root.add("sorting_weight", this->sorting_entitys_[obj].weight);
     }
-  });
+  }
+  if (std::isnan(value)) {
+    root.add("value", "\"NaN\"");
+    root.add("state", "NA");
+  } else {
+    root.add("value", value_accuracy_to_string(value, step_to_accuracy_decimals(obj->traits.get_step())));
+    std::string state = value_accuracy_to_string(value, step_to_accuracy_decimals(obj->traits.get_step()));
+    if (!obj->traits.get_unit_of_measurement().empty())
+      state += " " + obj->traits.get_unit_of_measurement();
+    root.add("state", state);
+  }
+  root.end_object();
+  return output;
 }
 #endif
 
 #ifdef USE_DATETIME_DATE
 void WebServer::on_date_update(datetime::DateEntity *obj) {
-  if (this->events_.count() == 0)
-    return;
-  this->events_.send(this->date_json(obj, DETAIL_STATE).c_str(), "state");
+  this->push_state_json_(obj, [this, obj]() { return this->date_json(obj, DETAIL_STATE); });
 }
 void WebServer::handle_date_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (auto *obj : App.get_dates()) {
     if (obj->get_object_id() != match.id)
       continue;
     if (request->method() == HTTP_GET) {
-      std::string data = this->date_json(obj, DETAIL_STATE);
+      std::string data = this->get_state_json_(obj, [this, obj]() { return this->date_json(obj, DETAIL_STATE); });
       request->send(200, "application/json", data.c_str());
       return;
     }
@@ -747,32 +830,33 @@ void WebServer::handle_date_request(AsyncWebServerRequest *request, const UrlMat
 }
 
 std::string WebServer::date_json(datetime::DateEntity *obj, JsonDetail start_config) {
-  return json::build_json([this, obj, start_config](JsonObject root) {
-    set_json_id(root, obj, "date-" + obj->get_object_id(), start_config);
-    std::string value = str_sprintf("%d-%02d-%02d", obj->year, obj->month, obj->day);
-    root["value"] = value;
-    root["state"] = value;
-    if (start_config == DETAIL_ALL) {
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-      }
+  std::string output;
+  json::JsonWriter root(output);
+  root.begin_object();
+  set_json_id(root, obj, "date-" + obj->get_object_id(), start_config);
+  std::string value = str_sprintf("%d-%02d-%02d", obj->year, obj->month, obj->day);
+  root.add("value", value);
+  root.add("state", value);
+  if (start_config == DETAIL_ALL) {
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      root.add("sorting_weight", this->sorting_entitys_[obj].weight);
     }
-  });
+  }
+  root.end_object();
+  return output;
 }
 #endif  // USE_DATETIME_DATE
 
 #ifdef USE_DATETIME_TIME
 void WebServer::on_time_update(datetime::TimeEntity *obj) {
-  if (this->events_.count() == 0)
-    return;
-  this->events_.send(this->time_json(obj, DETAIL_STATE).c_str(), "state");
+  this->push_state_json_(obj, [this, obj]() { return this->time_json(obj, DETAIL_STATE); });
 }
 void WebServer::handle_time_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (auto *obj : App.get_times()) {
     if (obj->get_object_id() != match.id)
       continue;
     if (request->method() == HTTP_GET && match.method.empty()) {
-      std::string data = this->time_json(obj, DETAIL_STATE);
+      std::string data = this->get_state_json_(obj, [this, obj]() { return this->time_json(obj, DETAIL_STATE); });
       request->send(200, "application/json", data.c_str());
       return;
     }
@@ -800,32 +884,33 @@ void WebServer::handle_time_request(AsyncWebServerRequest *request, const UrlMat
   request->send(404);
 }
 std::string WebServer::time_json(datetime::TimeEntity *obj, JsonDetail start_config) {
-  return json::build_json([this, obj, start_config](JsonObject root) {
-    set_json_id(root, obj, "time-" + obj->get_object_id(), start_config);
-    std::string value = str_sprintf("%02d:%02d:%02d", obj->hour, obj->minute, obj->second);
-    root["value"] = value;
-    root["state"] = value;
-    if (start_config == DETAIL_ALL) {
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-      }
+  std::string output;
+  json::JsonWriter root(output);
+  root.begin_object();
+  set_json_id(root, obj, "time-" + obj->get_object_id(), start_config);
+  std::string value = str_sprintf("%02d:%02d:%02d", obj->hour, obj->minute, obj->second);
+  root.add("value", value);
+  root.add("state", value);
+  if (start_config == DETAIL_ALL) {
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      root.add("sorting_weight", this->sorting_entitys_[obj].weight);
     }
-  });
+  }
+  root.end_object();
+  return output;
 }
 #endif  // USE_DATETIME_TIME
 
 #ifdef USE_DATETIME_DATETIME
 void WebServer::on_datetime_update(datetime::DateTimeEntity *obj) {
-  if (this->events_.count() == 0)
-    return;
-  this->events_.send(this->datetime_json(obj, DETAIL_STATE).c_str(), "state");
+  this->push_state_json_(obj, [this, obj]() { return this->datetime_json(obj, DETAIL_STATE); });
 }
 void WebServer::handle_datetime_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (auto *obj : App.get_datetimes()) {
     if (obj->get_object_id() != match.id)
       continue;
     if (request->method() == HTTP_GET && match.method.empty()) {
-      std::string data = this->datetime_json(obj, DETAIL_STATE);
+      std::string data = this->get_state_json_(obj, [this, obj]() { return this->datetime_json(obj, DETAIL_STATE); });
       request->send(200, "application/json", data.c_str());
       return;
     }
@@ -853,26 +938,27 @@ void WebServer::handle_datetime_request(AsyncWebServerRequest *request, const Ur
   request->send(404);
 }
 std::string WebServer::datetime_json(datetime::DateTimeEntity *obj, JsonDetail start_config) {
-  return json::build_json([this, obj, start_config](JsonObject root) {
-    set_json_id(root, obj, "datetime-" + obj->get_object_id(), start_config);
-    std::string value = str_sprintf("%d-%02d-%02d %02d:%02d:%02d", obj->year, obj->month, obj->day, obj->hour,
-                                    obj->minute, obj->second);
-    root["value"] = value;
-    root["state"] = value;
-    if (start_config == DETAIL_ALL) {
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-      }
+  std::string output;
+  json::JsonWriter root(output);
+  root.begin_object();
+  set_json_id(root, obj, "datetime-" + obj->get_object_id(), start_config);
+  std::string value = str_sprintf("%d-%02d-%02d %02d:%02d:%02d", obj->year, obj->month, obj->day, obj->hour,
+                                  obj->minute, obj->second);
+  root.add("value", value);
+  root.add("state", value);
+  if (start_config == DETAIL_ALL) {
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      root.add("sorting_weight", this->sorting_entitys_[obj].weight);
     }
-  });
+  }
+  root.end_object();
+  return output;
 }
 #endif  // USE_DATETIME_DATETIME
 
 #ifdef USE_TEXT
 void WebServer::on_text_update(text::Text *obj, const std::string &state) {
-  if (this->events_.count() == 0)
-    return;
-  this->events_.send(this->text_json(obj, state, DETAIL_STATE).c_str(), "state");
+  this->push_state_json_(obj, [this, obj, state]() { return this->text_json(obj, state, DETAIL_STATE); });
 }
 void WebServer::handle_text_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (auto *obj : App.get_texts()) {
@@ -880,7 +966,8 @@ void WebServer::handle_text_request(AsyncWebServerRequest *request, const UrlMat
       continue;
 
     if (request->method() == HTTP_GET && match.method.empty()) {
-      std::string data = this->text_json(obj, obj->state, DETAIL_STATE);
+      std::string data =
+          this->get_state_json_(obj, [this, obj]() { return this->text_json(obj, obj->state, DETAIL_STATE); });
       request->send(200, "text/json", data.c_str());
       return;
     }
@@ -903,32 +990,33 @@ void WebServer::handle_text_request(AsyncWebServerRequest *request, const UrlMat
 }
 
 std::string WebServer::text_json(text::Text *obj, const std::string &value, JsonDetail start_config) {
-  return json::build_json([this, obj, value, start_config](JsonObject root) {
-    set_json_id(root, obj, "text-" + obj->get_object_id(), start_config);
-    root["min_length"] = obj->traits.get_min_length();
-    root["max_length"] = obj->traits.get_max_length();
-    root["pattern"] = obj->traits.get_pattern();
-    if (obj->traits.get_mode() == text::TextMode::TEXT_MODE_PASSWORD) {
-      root["state"] = "********";
-    } else {
-      root["state"] = value;
-    }
-    root["value"] = value;
-    if (start_config == DETAIL_ALL) {
-      root["mode"] = (int) obj->traits.get_mode();
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-      }
+  std::string output;
+  json::JsonWriter root(output);
+  root.begin_object();
+  set_json_id(root, obj, "text-" + obj->get_object_id(), start_config);
+  root.add("min_length", obj->traits.get_min_length());
+  root.add("max_length", obj->traits.get_max_length());
+  root.add("pattern", obj->traits.get_pattern());
+  if (obj->traits.get_mode() == text::TextMode::TEXT_MODE_PASSWORD) {
+    root.add("state", "********");
+  } else {
+    root.add("state", value);
+  }
+  root.add("value", value);
+  if (start_config == DETAIL_ALL) {
+    root.add("mode", (int) obj->traits.get_mode());
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      root.add("sorting_weight", this->sorting_entitys_[obj].weight);
     }
-  });
+  }
+  root.end_object();
+  return output;
 }
 #endif
 
 #ifdef USE_SELECT
 void WebServer::on_select_update(select::Select *obj, const std::string &state, size_t index) {
-  if (this->events_.count() == 0)
-    return;
-  this->events_.send(this->select_json(obj, state, DETAIL_STATE).c_str(), "state");
+  this->push_state_json_(obj, [this, obj, state]() { return this->select_json(obj, state, DETAIL_STATE); });
 }
 void WebServer::handle_select_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (auto *obj : App.get_selects()) {
@@ -941,7 +1029,12 @@ void WebServer::handle_select_request(AsyncWebServerRequest *request, const UrlM
       if (param && param->value() == "all") {
         detail = DETAIL_ALL;
       }
-      std::string data = this->select_json(obj, obj->state, detail);
+      std::string data;
+      if (detail == DETAIL_STATE) {
+        data = this->get_state_json_(obj, [this, obj]() { return this->select_json(obj, obj->state, DETAIL_STATE); });
+      } else {
+        data = this->select_json(obj, obj->state, detail);
+      }
       request->send(200, "application/json", data.c_str());
       return;
     }
@@ -965,18 +1058,22 @@ void WebServer::handle_select_request(AsyncWebServerRequest *request, const UrlM
   request->send(404);
 }
 std::string WebServer::select_json(select::Select *obj, const std::string &value, JsonDetail start_config) {
-  return json::build_json([this, obj, value, start_config](JsonObject root) {
-    set_json_icon_state_value(root, obj, "select-" + obj->get_object_id(), value, value, start_config);
-    if (start_config == DETAIL_ALL) {
-      JsonArray opt = root.createNestedArray("option");
-      for (auto &option : obj->traits.get_options()) {
-        opt.add(option);
-      }
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-      }
+  std::string output;
+  json::JsonWriter root(output);
+  root.begin_object();
+  set_json_icon_state_value(root, obj, "select-" + obj->get_object_id(), value, value, start_config);
+  if (start_config == DETAIL_ALL) {
+    root.begin_array("option");
+    for (auto &option : obj->traits.get_options()) {
+      root.value(option);
+    }
+    root.end_array();
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      root.add("sorting_weight", this->sorting_entitys_[obj].weight);
     }
-  });
+  }
+  root.end_object();
+  return output;
 }
 #endif
 
@@ -985,9 +1082,7 @@ std::string WebServer::select_json(select::Select *obj, const std::string &value
 
 #ifdef USE_CLIMATE
 void WebServer::on_climate_update(climate::Climate *obj) {
-  if (this->events_.count() == 0)
-    return;
-  this->events_.send(this->climate_json(obj, DETAIL_STATE).c_str(), "state");
+  this->push_state_json_(obj, [this, obj]() { return this->climate_json(obj, DETAIL_STATE); });
 }
 void WebServer::handle_climate_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (auto *obj : App.get_climates()) {
@@ -995,7 +1090,7 @@ void WebServer::handle_climate_request(AsyncWebServerRequest *request, const Url
       continue;
 
     if (request->method() == HTTP_GET && match.method.empty()) {
-      std::string data = this->climate_json(obj, DETAIL_STATE);
+      std::string data = this->get_state_json_(obj, [this, obj]() { return this->climate_json(obj, DETAIL_STATE); });
       request->send(200, "application/json", data.c_str());
       return;
     }
@@ -1037,101 +1132,109 @@ void WebServer::handle_climate_request(AsyncWebServerRequest *request, const Url
   request->send(404);
 }
 std::string WebServer::climate_json(climate::Climate *obj, JsonDetail start_config) {
-  return json::build_json([this, obj, start_config](JsonObject root) {
-    set_json_id(root, obj, "climate-" + obj->get_object_id(), start_config);
-    const auto traits = obj->get_traits();
-    int8_t target_accuracy = traits.get_target_temperature_accuracy_decimals();
-    int8_t current_accuracy = traits.get_current_temperature_accuracy_decimals();
-    char buf[16];
-
-    if (start_config == DETAIL_ALL) {
-      JsonArray opt = root.createNestedArray("modes");
-      for (climate::ClimateMode m : traits.get_supported_modes())
-        opt.add(PSTR_LOCAL(climate::climate_mode_to_string(m)));
-      if (!traits.get_supported_custom_fan_modes().empty()) {
-        JsonArray opt = root.createNestedArray("fan_modes");
-        for (climate::ClimateFanMode m : traits.get_supported_fan_modes())
-          opt.add(PSTR_LOCAL(climate::climate_fan_mode_to_string(m)));
-      }
-
-      if (!traits.get_supported_custom_fan_modes().empty()) {
-        JsonArray opt = root.createNestedArray("custom_fan_modes");
-        for (auto const &custom_fan_mode : traits.get_supported_custom_fan_modes())
-          opt.add(custom_fan_mode);
-      }
-      if (traits.get_supports_swing_modes()) {
-        JsonArray opt = root.createNestedArray("swing_modes");
-        for (auto swing_mode : traits.get_supported_swing_modes())
-          opt.add(PSTR_LOCAL(climate::climate_swing_mode_to_string(swing_mode)));
-      }
-      if (traits.get_supports_presets() && obj->preset.has_value()) {
-        JsonArray opt = root.createNestedArray("presets");
-        for (climate::ClimatePreset m : traits.get_supported_presets())
-          opt.add(PSTR_LOCAL(climate::climate_preset_to_string(m)));
-      }
-      if (!traits.get_supported_custom_presets().empty() && obj->custom_preset.has_value()) {
-        JsonArray opt = root.createNestedArray("custom_presets");
-        for (auto const &custom_preset : traits.get_supported_custom_presets())
-          opt.add(custom_preset);
-      }
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-      }
-    }
-
-    bool has_state = false;
-    root["mode"] = PSTR_LOCAL(climate_mode_to_string(obj->mode));
-    root["max_temp"] = value_accuracy_to_string(traits.get_visual_max_temperature(), target_accuracy);
-    root["min_temp"] = value_accuracy_to_string(traits.get_visual_min_temperature(), target_accuracy);
-    root["step"] = traits.get_visual_target_temperature_step();
-    if (traits.get_supports_action()) {
-      root["action"] = PSTR_LOCAL(climate_action_to_string(obj->action));
-      root["state"] = root["action"];
-      has_state = true;
-    }
-    if (traits.get_supports_fan_modes() && obj->fan_mode.has_value()) {
-      root["fan_mode"] = PSTR_LOCAL(climate_fan_mode_to_string(obj->fan_mode.value()));
+  std::string output;
+  json::JsonWriter root(output);
+  root.begin_object();
+  set_json_id(root, obj, "climate-" + obj->get_object_id(), start_config);
+  const auto traits = obj->get_traits();
+  int8_t target_accuracy = traits.get_target_temperature_accuracy_decimals();
+  int8_t current_accuracy = traits.get_current_temperature_accuracy_decimals();
+  char buf[16];
+
+  if (start_config == DETAIL_ALL) {
+    root.begin_array("modes");
+    for (climate::ClimateMode m : traits.get_supported_modes())
+      root.value(PSTR_LOCAL(climate::climate_mode_to_string(m)));
+    root.end_array();
+    if (!traits.get_supported_custom_fan_modes().empty()) {
+      root.begin_array("fan_modes");
+      for (climate::ClimateFanMode m : traits.get_supported_fan_modes())
+        root.value(PSTR_LOCAL(climate::climate_fan_mode_to_string(m)));
+      root.end_array();
+    }
+
+    if (!traits.get_supported_custom_fan_modes().empty()) {
+      root.begin_array("custom_fan_modes");
+      for (auto const &custom_fan_mode : traits.get_supported_custom_fan_modes())
+        root.value(custom_fan_mode);
+      root.end_array();
     }
-    if (!traits.get_supported_custom_fan_modes().empty() && obj->custom_fan_mode.has_value()) {
-      root["custom_fan_mode"] = obj->custom_fan_mode.value().c_str();
+    if (traits.get_supports_swing_modes()) {
+      root.begin_array("swing_modes");
+      for (auto swing_mode : traits.get_supported_swing_modes())
+        root.value(PSTR_LOCAL(climate::climate_swing_mode_to_string(swing_mode)));
+      root.end_array();
     }
     if (traits.get_supports_presets() && obj->preset.has_value()) {
-      root["preset"] = PSTR_LOCAL(climate_preset_to_string(obj->preset.value()));
+      root.begin_array("presets");
+      for (climate::ClimatePreset m : traits.get_supported_presets())
+        root.value(PSTR_LOCAL(climate::climate_preset_to_string(m)));
+      root.end_array();
     }
     if (!traits.get_supported_custom_presets().empty() && obj->custom_preset.has_value()) {
-      root["custom_preset"] = obj->custom_preset.value().c_str();
-    }
-    if (traits.get_supports_swing_modes()) {
-      root["swing_mode"] = PSTR_LOCAL(climate_swing_mode_to_string(obj->swing_mode));
+      root.begin_array("custom_presets");
+      for (auto const &custom_preset : traits.get_supported_custom_presets())
+        root.value(custom_preset);
+      root.end_array();
     }
-    if (traits.get_supports_current_temperature()) {
-      if (!std::isnan(obj->current_temperature)) {
-        root["current_temperature"] = value_accuracy_to_string(obj->current_temperature, current_accuracy);
-      } else {
-        root["current_temperature"] = "NA";
-      }
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      root.add("sorting_weight", this->sorting_entitys_[obj].weight);
     }
-    if (traits.get_supports_two_point_target_temperature()) {
-      root["target_temperature_low"] = value_accuracy_to_string(obj->target_temperature_low, target_accuracy);
-      root["target_temperature_high"] = value_accuracy_to_string(obj->target_temperature_high, target_accuracy);
-      if (!has_state) {
-        root["state"] = value_accuracy_to_string((obj->target_temperature_high + obj->target_temperature_low) / 2.0f,
-                                                 target_accuracy);
-      }
+  }
+
+  bool has_state = false;
+  root.add("mode", PSTR_LOCAL(climate_mode_to_string(obj->mode)));
+  root.add("max_temp", value_accuracy_to_string(traits.get_visual_max_temperature(), target_accuracy));
+  root.add("min_temp", value_accuracy_to_string(traits.get_visual_min_temperature(), target_accuracy));
+  root.add("step", traits.get_visual_target_temperature_step());
+  if (traits.get_supports_action()) {
+    root.add("action", PSTR_LOCAL(climate_action_to_string(obj->action)));
+    root.add("state", buf);
+    has_state = true;
+  }
+  if (traits.get_supports_fan_modes() && obj->fan_mode.has_value()) {
+    root.add("fan_mode", PSTR_LOCAL(climate_fan_mode_to_string(obj->fan_mode.value())));
+  }
+  if (!traits.get_supported_custom_fan_modes().empty() && obj->custom_fan_mode.has_value()) {
+    root.add("custom_fan_mode", obj->custom_fan_mode.value().c_str());
+  }
+  if (traits.get_supports_presets() && obj->preset.has_value()) {
+    root.add("preset", PSTR_LOCAL(climate_preset_to_string(obj->preset.value())));
+  }
+  if (!traits.get_supported_custom_presets().empty() && obj->custom_preset.has_value()) {
+    root.add("custom_preset", obj->custom_preset.value().c_str());
+  }
+  if (traits.get_supports_swing_modes()) {
+    root.add("swing_mode", PSTR_LOCAL(climate_swing_mode_to_string(obj->swing_mode)));
+  }
+  if (traits.get_supports_current_temperature()) {
+    if (!std::isnan(obj->current_temperature)) {
+      root.add("current_temperature", value_accuracy_to_string(obj->current_temperature, current_accuracy));
     } else {
-      root["target_temperature"] = value_accuracy_to_string(obj->target_temperature, target_accuracy);
-      if (!has_state)
-        root["state"] = root["target_temperature"];
+      root.add("current_temperature", "NA");
     }
-  });
+  }
+  if (traits.get_supports_two_point_target_temperature()) {
+    root.add("target_temperature_low", value_accuracy_to_string(obj->target_temperature_low, target_accuracy));
+    root.add("target_temperature_high", value_accuracy_to_string(obj->target_temperature_high, target_accuracy));
+    if (!has_state) {
+      root.add("state", value_accuracy_to_string((obj->target_temperature_high + obj->target_temperature_low) / 2.0f,
+                                                 target_accuracy));
+    }
+  } else {
+    std::string target_temperature = value_accuracy_to_string(obj->target_temperature, target_accuracy);
+    root.add("target_temperature", target_temperature);
+    if (!has_state)
+      root.add("state", target_temperature);
+  }
+  root.end_object();
+  return output;
 }
 #endif
 
 #ifdef USE_LOCK
 void WebServer::on_lock_update(lock::Lock *obj) {
-  if (this->events_.count() == 0)
-    return;
-  this->events_.send(this->lock_json(obj, obj->state, DETAIL_STATE).c_str(), "state");
+  this->push_state_json_(obj, [this, obj]() { return this->lock_json(obj, obj->state, DETAIL_STATE); });
 }
 void WebServer::handle_lock_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (lock::Lock *obj : App.get_locks()) {
@@ -1139,7 +1242,8 @@ void WebServer::handle_lock_request(AsyncWebServerRequest *request, const UrlMat
       continue;
 
     if (request->method() == HTTP_GET && match.method.empty()) {
-      std::string data = this->lock_json(obj, obj->state, DETAIL_STATE);
+      std::string data =
+          this->get_state_json_(obj, [this, obj]() { return this->lock_json(obj, obj->state, DETAIL_STATE); });
       request->send(200, "application/json", data.c_str());
     } else if (match.method == "lock") {
       this->schedule_([obj]() { obj->lock(); });
@@ -1158,23 +1262,24 @@ void WebServer::handle_lock_request(AsyncWebServerRequest *request, const UrlMat
   request->send(404);
 }
 std::string WebServer::lock_json(lock::Lock *obj, lock::LockState value, JsonDetail start_config) {
-  return json::build_json([this, obj, value, start_config](JsonObject root) {
-    set_json_icon_state_value(root, obj, "lock-" + obj->get_object_id(), lock::lock_state_to_string(value), value,
-                              start_config);
-    if (start_config == DETAIL_ALL) {
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-      }
+  std::string output;
+  json::JsonWriter root(output);
+  root.begin_object();
+  set_json_icon_state_value(root, obj, "lock-" + obj->get_object_id(), lock::lock_state_to_string(value), value,
+                            start_config);
+  if (start_config == DETAIL_ALL) {
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      root.add("sorting_weight", this->sorting_entitys_[obj].weight);
     }
-  });
+  }
+  root.end_object();
+  return output;
 }
 #endif
 
 #ifdef USE_VALVE
 void WebServer::on_valve_update(valve::Valve *obj) {
-  if (this->events_.count() == 0)
-    return;
-  this->events_.send(this->valve_json(obj, DETAIL_STATE).c_str(), "state");
+  this->push_state_json_(obj, [this, obj]() { return this->valve_json(obj, DETAIL_STATE); });
 }
 void WebServer::handle_valve_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (valve::Valve *obj : App.get_valves()) {
@@ -1182,7 +1287,7 @@ void WebServer::handle_valve_request(AsyncWebServerRequest *request, const UrlMa
       continue;
 
     if (request->method() == HTTP_GET && match.method.empty()) {
-      std::string data = this->valve_json(obj, DETAIL_STATE);
+      std::string data = this->get_state_json_(obj, [this, obj]() { return this->valve_json(obj, DETAIL_STATE); });
       request->send(200, "application/json", data.c_str());
       continue;
     }
@@ -1221,25 +1326,27 @@ void WebServer::handle_valve_request(AsyncWebServerRequest *request, const UrlMa
   request->send(404);
 }
 std::string WebServer::valve_json(valve::Valve *obj, JsonDetail start_config) {
-  return json::build_json([this, obj, start_config](JsonObject root) {
-    set_json_icon_state_value(root, obj, "valve-" + obj->get_object_id(), obj->is_fully_closed() ? "CLOSED" : "OPEN",
-                              obj->position, start_config);
-    root["current_operation"] = valve::valve_operation_to_str(obj->current_operation);
-
-    if (obj->get_traits().get_supports_position())
-      root["position"] = obj->position;
-    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-      root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-    }
-  });
+  std::string output;
+  json::JsonWriter root(output);
+  root.begin_object();
+  set_json_icon_state_value(root, obj, "valve-" + obj->get_object_id(), obj->is_fully_closed() ? "CLOSED" : "OPEN",
+                            obj->position, start_config);
+  root.add("current_operation", valve::valve_operation_to_str(obj->current_operation));
+
+  if (obj->get_traits().get_supports_position())
+    root.add("position", obj->position);
+  if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+    root.add("sorting_weight", this->sorting_entitys_[obj].weight);
+  }
+  root.end_object();
+  return output;
 }
 #endif
 
 #ifdef USE_ALARM_CONTROL_PANEL
 void WebServer::on_alarm_control_panel_update(alarm_control_panel::AlarmControlPanel *obj) {
-  if (this->events_.count() == 0)
-    return;
-  this->events_.send(this->alarm_control_panel_json(obj, obj->get_state(), DETAIL_STATE).c_str(), "state");
+  this->push_state_json_(
+      obj, [this, obj]() { return this->alarm_control_panel_json(obj, obj->get_state(), DETAIL_STATE); });
 }
 void WebServer::handle_alarm_control_panel_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (alarm_control_panel::AlarmControlPanel *obj : App.get_alarm_control_panels()) {
@@ -1247,7 +1354,8 @@ void WebServer::handle_alarm_control_panel_request(AsyncWebServerRequest *reques
       continue;
 
     if (request->method() == HTTP_GET && match.method.empty()) {
-      std::string data = this->alarm_control_panel_json(obj, obj->get_state(), DETAIL_STATE);
+      std::string data = this->get_state_json_(
+          obj, [this, obj]() { return this->alarm_control_panel_json(obj, obj->get_state(), DETAIL_STATE); });
       request->send(200, "application/json", data.c_str());
       return;
     }
@@ -1257,16 +1365,19 @@ void WebServer::handle_alarm_control_panel_request(AsyncWebServerRequest *reques
 std::string WebServer::alarm_control_panel_json(alarm_control_panel::AlarmControlPanel *obj,
                                                 alarm_control_panel::AlarmControlPanelState value,
                                                 JsonDetail start_config) {
-  return json::build_json([this, obj, value, start_config](JsonObject root) {
-    char buf[16];
-    set_json_icon_state_value(root, obj, "alarm-control-panel-" + obj->get_object_id(),
-                              PSTR_LOCAL(alarm_control_panel_state_to_string(value)), value, start_config);
-    if (start_config == DETAIL_ALL) {
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-      }
+  std::string output;
+  json::JsonWriter root(output);
+  root.begin_object();
+  char buf[16];
+  set_json_icon_state_value(root, obj, "alarm-control-panel-" + obj->get_object_id(),
+                            PSTR_LOCAL(alarm_control_panel_state_to_string(value)), value, start_config);
+  if (start_config == DETAIL_ALL) {
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      root.add("sorting_weight", this->sorting_entitys_[obj].weight);
     }
-  });
+  }
+  root.end_object();
+  return output;
 }
 #endif
 
@@ -1276,27 +1387,29 @@ void WebServer::on_event(event::Event *obj, const std::string &event_type) {
 }
 
 std::string WebServer::event_json(event::Event *obj, const std::string &event_type, JsonDetail start_config) {
-  return json::build_json([obj, event_type, start_config](JsonObject root) {
-    set_json_id(root, obj, "event-" + obj->get_object_id(), start_config);
-    if (!event_type.empty()) {
-      root["event_type"] = event_type;
-    }
-    if (start_config == DETAIL_ALL) {
-      JsonArray event_types = root.createNestedArray("event_types");
-      for (auto const &event_type : obj->get_event_types()) {
-        event_types.add(event_type);
-      }
-      root["device_class"] = obj->get_device_class();
+  std::string output;
+  json::JsonWriter root(output);
+  root.begin_object();
+  set_json_id(root, obj, "event-" + obj->get_object_id(), start_config);
+  if (!event_type.empty()) {
+    root.add("event_type", event_type);
+  }
+  if (start_config == DETAIL_ALL) {
+    root.begin_array("event_types");
+    for (auto const &event_type : obj->get_event_types()) {
+      root.value(event_type);
     }
-  });
+    root.end_array();
+    root.add("device_class", obj->get_device_class());
+  }
+  root.end_object();
+  return output;
 }
 #endif
 
 #ifdef USE_UPDATE
 void WebServer::on_update(update::UpdateEntity *obj) {
-  if (this->events_.count() == 0)
-    return;
-  this->events_.send(this->update_json(obj, DETAIL_STATE).c_str(), "state");
+  this->push_state_json_(obj, [this, obj]() { return this->update_json(obj, DETAIL_STATE); });
 }
 void WebServer::handle_update_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (update::UpdateEntity *obj : App.get_updates()) {
@@ -1304,7 +1417,7 @@ void WebServer::handle_update_request(AsyncWebServerRequest *request, const UrlM
       continue;
 
     if (request->method() == HTTP_GET && match.method.empty()) {
-      std::string data = this->update_json(obj, DETAIL_STATE);
+      std::string data = this->get_state_json_(obj, [this, obj]() { return this->update_json(obj, DETAIL_STATE); });
       request->send(200, "application/json", data.c_str());
       return;
     }
@@ -1321,33 +1434,36 @@ void WebServer::handle_update_request(AsyncWebServerRequest *request, const UrlM
   request->send(404);
 }
 std::string WebServer::update_json(update::UpdateEntity *obj, JsonDetail start_config) {
-  return json::build_json([this, obj, start_config](JsonObject root) {
-    set_json_id(root, obj, "update-" + obj->get_object_id(), start_config);
-    root["value"] = obj->update_info.latest_version;
-    switch (obj->state) {
-      case update::UPDATE_STATE_NO_UPDATE:
-        root["state"] = "NO UPDATE";
-        break;
-      case update::UPDATE_STATE_AVAILABLE:
-        root["state"] = "UPDATE AVAILABLE";
-        break;
-      case update::UPDATE_STATE_INSTALLING:
-        root["state"] = "INSTALLING";
-        break;
-      default:
-        root["state"] = "UNKNOWN";
-        break;
-    }
-    if (start_config == DETAIL_ALL) {
-      root["current_version"] = obj->update_info.current_version;
-      root["title"] = obj->update_info.title;
-      root["summary"] = obj->update_info.summary;
-      root["release_url"] = obj->update_info.release_url;
-      if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
-      }
+  std::string output;
+  json::JsonWriter root(output);
+  root.begin_object();
+  set_json_id(root, obj, "update-" + obj->get_object_id(), start_config);
+  root.add("value", obj->update_info.latest_version);
+  switch (obj->state) {
+    case update::UPDATE_STATE_NO_UPDATE:
+      root.add("state", "NO UPDATE");
+      break;
+    case update::UPDATE_STATE_AVAILABLE:
+      root.add("state", "UPDATE AVAILABLE");
+      break;
+    case update::UPDATE_STATE_INSTALLING:
+      root.add("state", "INSTALLING");
+      break;
+    default:
+      root.add("state", "UNKNOWN");
+      break;
+  }
+  if (start_config == DETAIL_ALL) {
+    root.add("current_version", obj->update_info.current_version);
+    root.add("title", obj->update_info.title);
+    root.add("summary", obj->update_info.summary);
+    root.add("release_url", obj->update_info.release_url);
+    if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
+      root.add("sorting_weight", this->sorting_entitys_[obj].weight);
     }
-  });
+  }
+  root.end_object();
+  return output;
 }
 #endif
 
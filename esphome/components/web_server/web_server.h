@@ -108,6 +108,11 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
    * @param expose_log.
    */
   void set_expose_log(bool expose_log) { this->expose_log_ = expose_log; }
+  /** Set the minimum time between two state pushes to the event source clients.
+   *
+   * State changes in between are coalesced, only the latest state of each entity is sent.
+   */
+  void set_events_interval(uint32_t events_interval) { this->events_interval_ = events_interval; }
 
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
@@ -340,11 +345,29 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
 
  protected:
   void schedule_(std::function<void()> &&f);
+  /// Queue the new state of an entity for the event source clients, replacing a state that wasn't sent yet.
+  void push_state_json_(EntityBase *obj, std::function<std::string()> &&build);
+  /// Send the queued states to the event source clients, unless they are rate limited or still busy.
+  void flush_state_json_();
+  /// Whether state changes of the entity remove its cached state JSON, only those entities are cached.
+  bool tracks_state_(EntityBase *obj) const;
+  /// Return the state JSON of an entity, only building it when its state changed since it was last built.
+  std::string get_state_json_(EntityBase *obj, const std::function<std::string()> &build);
   friend ListEntitiesIterator;
   web_server_base::WebServerBase *base_;
   AsyncEventSource events_{"/events"};
   ListEntitiesIterator entities_iterator_;
   std::map<EntityBase *, SortingComponents> sorting_entitys_;
+  /// DETAIL_STATE JSON of the entities, removed when their state changes. Requests are handled in another task on
+  /// some platforms, hence the lock.
+  std::map<EntityBase *, std::string> state_json_cache_;
+  Mutex state_json_lock_;
+  /// Configuration JSON sent to every event source client when it connects, built in setup().
+  std::string config_json_;
+  /// Builders of the state JSON of the entities that changed since the last push to the event source clients.
+  std::vector<std::pair<EntityBase *, std::function<std::string()>>> pending_states_;
+  uint32_t events_interval_{0};
+  uint32_t last_events_push_{0};
 #if USE_WEBSERVER_VERSION == 1
   const char *css_url_{nullptr};
   const char *js_url_{nullptr};
@@ -1,6 +1,7 @@
 #ifdef USE_ESP_IDF
 
 #include <cstdarg>
+#include <sys/socket.h>
 
 #include "esphome/core/log.h"
 #include "esphome/core/helpers.h"
@@ -21,6 +22,8 @@ namespace web_server_idf {
 #define CRLF_LEN (sizeof(CRLF_STR) - 1)
 
 static const char *const TAG = "web_server_idf";
+/// Events queued per event source session before new ones are dropped.
+static const size_t MAX_QUEUED_EVENTS = 32;
 
 void AsyncWebServer::end() {
   if (this->server_) {
@@ -283,12 +286,65 @@ void AsyncEventSource::handleRequest(AsyncWebServerRequest *request) {
   this->sessions_.insert(rsp);
 }
 
+/// Format an event in the text/event-stream format, or return an empty string if it has no fields.
+static std::string build_event(const char *message, const char *event, uint32_t id, uint32_t reconnect) {
+  std::string ev;
+
+  if (reconnect) {
+    ev.append("retry: ", sizeof("retry: ") - 1);
+    ev.append(to_string(reconnect));
+    ev.append(CRLF_STR, CRLF_LEN);
+  }
+
+  if (id) {
+    ev.append("id: ", sizeof("id: ") - 1);
+    ev.append(to_string(id));
+    ev.append(CRLF_STR, CRLF_LEN);
+  }
+
+  if (event && *event) {
+    ev.append("event: ", sizeof("event: ") - 1);
+    ev.append(event);
+    ev.append(CRLF_STR, CRLF_LEN);
+  }
+
+  if (message && *message) {
+    ev.append("data: ", sizeof("data: ") - 1);
+    ev.append(message);
+    ev.append(CRLF_STR, CRLF_LEN);
+  }
+
+  if (!ev.empty())
+    ev.append(CRLF_STR, CRLF_LEN);
+  return ev;
+}
+
 void AsyncEventSource::send(const char *message, const char *event, uint32_t id, uint32_t reconnect) {
+  if (this->sessions_.empty())
+    return;
+  // Format the event once for all sessions
+  std::string ev = build_event(message, event, id, reconnect);
+  if (ev.empty())
+    return;
   for (auto *ses : this->sessions_) {
-    ses->send(message, event, id, reconnect);
+    ses->send_event_(ev);
   }
 }
 
+size_t AsyncEventSource::avgPacketsWaiting() const {
+  if (this->sessions_.empty())
+    return 0;
+  size_t waiting = 0;
+  for (auto *ses : this->sessions_)
+    waiting += ses->packetsWaiting();
+  return (waiting + this->sessions_.size() - 1) / this->sessions_.size();
+}
+
+void AsyncEventSource::loop() {
+  for (auto *ses : this->sessions_)
+    ses->flush_();
+}
+
 AsyncEventSourceResponse::AsyncEventSourceResponse(const AsyncWebServerRequest *request, AsyncEventSource *server)
     : server_(server) {
   httpd_req_t *req = *request;
@@ -321,48 +377,50 @@ void AsyncEventSourceResponse::send(const char *message, const char *event, uint
   if (this->fd_ == 0) {
     return;
   }
+  std::string ev = build_event(message, event, id, reconnect);
+  if (!ev.empty())
+    this->send_event_(ev);
+}
 
-  std::string ev;
-
-  if (reconnect) {
-    ev.append("retry: ", sizeof("retry: ") - 1);
-    ev.append(to_string(reconnect));
-    ev.append(CRLF_STR, CRLF_LEN);
-  }
-
-  if (id) {
-    ev.append("id: ", sizeof("id: ") - 1);
-    ev.append(to_string(id));
-    ev.append(CRLF_STR, CRLF_LEN);
-  }
-
-  if (event && *event) {
-    ev.append("event: ", sizeof("event: ") - 1);
-    ev.append(event);
-    ev.append(CRLF_STR, CRLF_LEN);
-  }
-
-  if (message && *message) {
-    ev.append("data: ", sizeof("data: ") - 1);
-    ev.append(message);
-    ev.append(CRLF_STR, CRLF_LEN);
+void AsyncEventSourceResponse::send_event_(const std::string &ev) {
+  if (this->fd_ == 0) {
+    return;
   }
-
-  if (ev.empty()) {
+  if (this->queue_.size() >= MAX_QUEUED_EVENTS) {
+    ESP_LOGW(TAG, "Event source client too slow, dropping event");
     return;
   }
 
-  ev.append(CRLF_STR, CRLF_LEN);
-
-  // Sending chunked content prelude
-  auto cs = str_snprintf("%x" CRLF_STR, 4 * sizeof(ev.size()) + CRLF_LEN, ev.size());
-  httpd_socket_send(this->hd_, this->fd_, cs.c_str(), cs.size(), 0);
-
-  // Sendiing content chunk
-  httpd_socket_send(this->hd_, this->fd_, ev.c_str(), ev.size(), 0);
+  // Chunk size, content and end of chunk
+  auto chunk = str_snprintf("%x" CRLF_STR, 4 * sizeof(ev.size()) + CRLF_LEN, ev.size());
+  chunk.reserve(chunk.size() + ev.size() + CRLF_LEN);
+  chunk.append(ev);
+  chunk.append(CRLF_STR, CRLF_LEN);
+  this->queue_.push_back(std::move(chunk));
+  this->flush_();
+}
 
-  // Indicate end of chunk
-  httpd_socket_send(this->hd_, this->fd_, CRLF_STR, CRLF_LEN, 0);
+void AsyncEventSourceResponse::flush_() {
+  while (this->fd_ != 0 && !this->queue_.empty()) {
+    const std::string &chunk = this->queue_.front();
+    int sent = httpd_socket_send(this->hd_, this->fd_, chunk.data() + this->queue_sent_,
+                                 chunk.size() - this->queue_sent_, MSG_DONTWAIT);
+    if (sent == HTTPD_SOCK_ERR_TIMEOUT)
+      return;
+    if (sent < 0) {
+      // Let the server close the session, which calls destroy() and removes it from the event source
+      httpd_sess_trigger_close(this->hd_, this->fd_);
+      this->fd_ = 0;
+      this->queue_.clear();
+      this->queue_sent_ = 0;
+      return;
+    }
+    this->queue_sent_ += sent;
+    if (this->queue_sent_ == chunk.size()) {
+      this->queue_.pop_front();
+      this->queue_sent_ = 0;
+    }
+  }
 }
 
 }  // namespace web_server_idf
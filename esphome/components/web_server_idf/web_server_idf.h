@@ -3,6 +3,7 @@
 
 #include <esp_http_server.h>
 
+#include <deque>
 #include <functional>
 #include <map>
 #include <set>
@@ -75,6 +76,10 @@ class AsyncResponseStream : public AsyncWebServerResponse {
   void print(const std::string &str) { this->content_.append(str); }
   void print(float value);
   void printf(const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+  size_t write(const uint8_t *data, size_t len) {
+    this->content_.append(reinterpret_cast<const char *>(data), len);
+    return len;
+  }
 
  protected:
   std::string content_;
@@ -221,13 +226,22 @@ class AsyncEventSourceResponse {
 
  public:
   void send(const char *message, const char *event = nullptr, uint32_t id = 0, uint32_t reconnect = 0);
+  /// Number of events that weren't completely written to the socket yet.
+  // NOLINTNEXTLINE(readability-identifier-naming)
+  size_t packetsWaiting() const { return this->queue_.size(); }
 
  protected:
   AsyncEventSourceResponse(const AsyncWebServerRequest *request, AsyncEventSource *server);
   static void destroy(void *p);
+  /// Queue an event that is already formatted and write as much as the socket takes without blocking.
+  void send_event_(const std::string &ev);
+  void flush_();
   AsyncEventSource *server_;
   httpd_handle_t hd_{};
   int fd_{};
+  /// Chunks waiting for the socket, the first one may have been partially written already.
+  std::deque<std::string> queue_;
+  size_t queue_sent_{0};
 };
 
 using AsyncEventSourceClient = AsyncEventSourceResponse;
@@ -252,6 +266,11 @@ class AsyncEventSource : public AsyncWebHandler {
   void send(const char *message, const char *event = nullptr, uint32_t id = 0, uint32_t reconnect = 0);
 
   size_t count() const { return this->sessions_.size(); }
+  // NOLINTNEXTLINE(readability-identifier-naming)
+  size_t avgPacketsWaiting() const;
+
+  /// Continue writing the queued events of the sessions whose socket was full.
+  void loop();
 
  protected:
   std::string url_;
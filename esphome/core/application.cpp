@@ -7,6 +7,10 @@
 #include "esphome/components/status_led/status_led.h"
 #endif
 
+#ifdef USE_SOCKET_POLL
+#include <cerrno>
+#endif
+
 namespace esphome {
 
 static const char *const TAG = "app";
@@ -83,7 +87,12 @@ void Application::loop() {
 
   auto elapsed = now - this->last_loop_;
   if (elapsed >= this->loop_interval_ || HighFrequencyLoopRequester::is_high_frequency()) {
+#ifdef USE_SOCKET_POLL
+    // Don't block, but still refresh which sockets have pending data
+    this->yield_with_poll_(0);
+#else
     yield();
+#endif
   } else {
     uint32_t delay_time = this->loop_interval_ - elapsed;
     uint32_t next_schedule = this->scheduler.next_schedule_in().value_or(delay_time);
@@ -91,7 +100,11 @@ void Application::loop() {
     // otherwise interval=0 schedules result in constant looping with almost no sleep
     next_schedule = std::max(next_schedule, delay_time / 2);
     delay_time = std::min(next_schedule, delay_time);
+#ifdef USE_SOCKET_POLL
+    this->yield_with_poll_(delay_time);
+#else
     delay(delay_time);
+#endif
   }
   this->last_loop_ = now;
 
@@ -108,6 +121,56 @@ void Application::loop() {
   }
 }
 
+#ifdef USE_SOCKET_POLL
+void Application::register_socket_fd(int fd) {
+  if (fd < 0)
+    return;
+  struct pollfd pfd {};
+  pfd.fd = fd;
+  pfd.events = POLLIN;
+  // Report the socket as ready until the next poll() so data that is already queued isn't missed
+  pfd.revents = POLLIN;
+  this->poll_fds_.push_back(pfd);
+}
+void Application::unregister_socket_fd(int fd) {
+  for (auto it = this->poll_fds_.begin(); it != this->poll_fds_.end(); ++it) {
+    if (it->fd == fd) {
+      this->poll_fds_.erase(it);
+      return;
+    }
+  }
+}
+bool Application::is_socket_ready(int fd) const {
+  for (const auto &pfd : this->poll_fds_) {
+    if (pfd.fd == fd)
+      return pfd.revents != 0;
+  }
+  return true;
+}
+void Application::yield_with_poll_(uint32_t delay_ms) {
+  if (this->poll_fds_.empty()) {
+    if (delay_ms == 0) {
+      yield();
+    } else {
+      delay(delay_ms);
+    }
+    return;
+  }
+
+  int ret = ::poll(this->poll_fds_.data(), this->poll_fds_.size(), static_cast<int>(delay_ms));
+  if (ret < 0) {
+    // Nothing is known about the sockets, let every owner try to read
+    for (auto &pfd : this->poll_fds_)
+      pfd.revents = POLLIN;
+    // Don't spin if poll() keeps failing, fall back to the plain sleep
+    if (errno != EINTR)
+      delay(delay_ms);
+  }
+  if (delay_ms == 0)
+    yield();
+}
+#endif
+
 void IRAM_ATTR HOT Application::feed_wdt() {
   static uint32_t last_feed = 0;
   uint32_t now = micros();
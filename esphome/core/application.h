@@ -9,6 +9,10 @@
 #include "esphome/core/preferences.h"
 #include "esphome/core/scheduler.h"
 
+#ifdef USE_SOCKET_POLL
+#include <poll.h>
+#endif
+
 #ifdef USE_BINARY_SENSOR
 #include "esphome/components/binary_sensor/binary_sensor.h"
 #endif
@@ -233,6 +237,22 @@ class Application {
 
   void schedule_dump_config() { this->dump_config_at_ = 0; }
 
+  /// Get all registered components, sorted by setup priority once setup() ran.
+  const std::vector<Component *> &get_components() const { return this->components_; }
+
+#ifdef USE_SOCKET_POLL
+  /** Register a socket file descriptor with the main loop.
+   *
+   * Instead of sleeping for the rest of the loop interval, the main loop waits in poll() on all registered
+   * descriptors and wakes up as soon as one of them becomes readable. Must be called from the main loop.
+   */
+  void register_socket_fd(int fd);
+  /// Remove a file descriptor previously added with register_socket_fd(), must be called before it is closed.
+  void unregister_socket_fd(int fd);
+  /// Whether the last poll() reported the descriptor as readable or closed. Unregistered descriptors are always ready.
+  bool is_socket_ready(int fd) const;
+#endif
+
   void feed_wdt();
 
   void reboot();
@@ -470,6 +490,13 @@ class Application {
 
   void feed_wdt_arch_();
 
+#ifdef USE_SOCKET_POLL
+  /// Wait up to delay_ms for any registered socket to become readable, and record which ones are.
+  void yield_with_poll_(uint32_t delay_ms);
+
+  std::vector<struct pollfd> poll_fds_{};
+#endif
+
   std::vector<Component *> components_{};
   std::vector<Component *> looping_components_{};
 
@@ -1,5 +1,6 @@
 #include "esphome/core/component.h"
 
+#include <algorithm>
 #include <cinttypes>
 #include <utility>
 #include "esphome/core/application.h"
@@ -84,24 +85,40 @@ void Component::call_dump_config() {
 }
 
 uint32_t Component::get_component_state() const { return this->component_state_; }
+void Component::call_loop_timed_() {
+#ifdef USE_COMPONENT_RUNTIME_STATS
+  const uint32_t start = micros();
+  this->call_loop();
+  this->loop_stats_.record(micros() - start);
+#else
+  this->call_loop();
+#endif
+}
 void Component::call() {
   uint32_t state = this->component_state_ & COMPONENT_STATE_MASK;
   switch (state) {
-    case COMPONENT_STATE_CONSTRUCTION:
+    case COMPONENT_STATE_CONSTRUCTION: {
       // State Construction: Call setup and set state to setup
       this->component_state_ &= ~COMPONENT_STATE_MASK;
       this->component_state_ |= COMPONENT_STATE_SETUP;
+#ifdef USE_COMPONENT_RUNTIME_STATS
+      const uint32_t start = micros();
       this->call_setup();
+      this->setup_time_us_ = micros() - start;
+#else
+      this->call_setup();
+#endif
       break;
+    }
     case COMPONENT_STATE_SETUP:
       // State setup: Call first loop and set state to loop
       this->component_state_ &= ~COMPONENT_STATE_MASK;
       this->component_state_ |= COMPONENT_STATE_LOOP;
-      this->call_loop();
+      this->call_loop_timed_();
       break;
     case COMPONENT_STATE_LOOP:
       // State loop: Call loop
-      this->call_loop();
+      this->call_loop_timed_();
       break;
     case COMPONENT_STATE_FAILED:  // NOLINT(bugprone-branch-clone)
       // State failed: Do nothing
@@ -228,6 +245,36 @@ void PollingComponent::stop_poller() {
 uint32_t PollingComponent::get_update_interval() const { return this->update_interval_; }
 void PollingComponent::set_update_interval(uint32_t update_interval) { this->update_interval_ = update_interval; }
 
+#ifdef USE_COMPONENT_RUNTIME_STATS
+void Component::reset_runtime_stats() {
+  this->loop_stats_.reset();
+  this->scheduler_stats_.reset();
+}
+
+void ComponentRuntimeStats::record(uint32_t duration_us) {
+  this->count++;
+  this->total_us += duration_us;
+  this->max_us = std::max(this->max_us, duration_us);
+  uint8_t bucket = duration_us == 0 ? 0 : 31 - __builtin_clz(duration_us);
+  if (bucket >= NUM_BUCKETS)
+    bucket = NUM_BUCKETS - 1;
+  this->buckets[bucket]++;
+}
+uint32_t ComponentRuntimeStats::percentile(float percentile) const {
+  if (this->count == 0)
+    return 0;
+  const auto target = static_cast<uint32_t>(std::ceil(this->count * percentile / 100.0f));
+  uint32_t seen = 0;
+  for (uint8_t i = 0; i < NUM_BUCKETS - 1; i++) {
+    seen += this->buckets[i];
+    if (seen >= target)
+      return std::min(this->max_us, (uint32_t(1) << (i + 1)) - 1);
+  }
+  return this->max_us;
+}
+void ComponentRuntimeStats::reset() { *this = ComponentRuntimeStats{}; }
+#endif
+
 WarnIfComponentBlockingGuard::WarnIfComponentBlockingGuard(Component *component)
     : started_(millis()), component_(component) {}
 WarnIfComponentBlockingGuard::~WarnIfComponentBlockingGuard() {
@@ -5,6 +5,7 @@
 #include <functional>
 #include <string>
 
+#include "esphome/core/defines.h"
 #include "esphome/core/optional.h"
 
 namespace esphome {
@@ -65,6 +66,24 @@ extern const uint32_t STATUS_LED_ERROR;
 
 enum class RetryResult { DONE, RETRY };
 
+#ifdef USE_COMPONENT_RUNTIME_STATS
+/// Call count and a log2 histogram of how long a component spent in one kind of callback, in microseconds.
+struct ComponentRuntimeStats {
+  /// Bucket i counts calls that took [2^i, 2^(i+1)) us, the last bucket also counts everything longer.
+  static const uint8_t NUM_BUCKETS = 16;
+
+  uint32_t count{0};
+  uint64_t total_us{0};
+  uint32_t max_us{0};
+  uint32_t buckets[NUM_BUCKETS]{};
+
+  void record(uint32_t duration_us);
+  /// Estimate a percentile (0-100) as the upper bound of the bucket it falls in, capped at the maximum.
+  uint32_t percentile(float percentile) const;
+  void reset();
+};
+#endif
+
 class Component {
  public:
   /** Where the component's initialization should happen.
@@ -153,12 +172,24 @@ class Component {
    */
   const char *get_component_source() const;
 
+#ifdef USE_COMPONENT_RUNTIME_STATS
+  /// Time spent in loop() since the last reset_runtime_stats().
+  const ComponentRuntimeStats &get_loop_stats() const { return this->loop_stats_; }
+  /// Time spent in timeouts/intervals of this component since the last reset_runtime_stats().
+  ComponentRuntimeStats &get_scheduler_stats() { return this->scheduler_stats_; }
+  /// Time setup() took, in microseconds.
+  uint32_t get_setup_time_us() const { return this->setup_time_us_; }
+  void reset_runtime_stats();
+#endif
+
  protected:
   friend class Application;
 
   virtual void call_loop();
   virtual void call_setup();
   virtual void call_dump_config();
+  /// Call call_loop(), recording its runtime when component runtime stats are enabled.
+  void call_loop_timed_();
 
   /** Set an interval function with a unique name. Empty name means no cancelling possible.
    *
@@ -272,6 +303,11 @@ class Component {
   uint32_t component_state_{0x0000};  ///< State of this component.
   float setup_priority_override_{NAN};
   const char *component_source_{nullptr};
+#ifdef USE_COMPONENT_RUNTIME_STATS
+  ComponentRuntimeStats loop_stats_;
+  ComponentRuntimeStats scheduler_stats_;
+  uint32_t setup_time_us_{0};
+#endif
 };
 
 /** This class simplifies creating components that periodically check a state.
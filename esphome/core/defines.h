@@ -38,6 +38,7 @@
 #define USE_LIGHT
 #define USE_LOCK
 #define USE_LOGGER
+#define USE_LOGGER_DEFERRED
 #define USE_LVGL
 #define USE_LVGL_ANIMIMG
 #define USE_LVGL_BINARY_SENSOR
@@ -81,6 +82,7 @@
 #ifdef USE_ARDUINO
 #define USE_CAPTIVE_PORTAL
 #define USE_PROMETHEUS
+#define USE_PROMETHEUS_GZIP
 #define USE_WEBSERVER
 #define USE_WEBSERVER_PORT 80  // NOLINT
 #define USE_WIFI_WPA2_EAP
@@ -99,6 +101,7 @@
 #define USE_ESP32_BLE_SERVER
 #define USE_ESP32_CAMERA
 #define USE_IMPROV
+#define USE_LOGGER_DEFERRED_TASKS
 #define USE_MICRO_WAKE_WORD_VAD
 #define USE_MICROPHONE
 #define USE_PSRAM
@@ -157,6 +160,7 @@
 
 #ifdef USE_HOST
 #define USE_SOCKET_IMPL_BSD_SOCKETS
+#define USE_SOCKET_POLL
 #endif
 
 // Disabled feature flags
@@ -6,6 +6,8 @@ namespace esphome {
 
 static const char *const TAG = "entity_base";
 
+uint32_t EntityBase::global_state_version_ = 0;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
 // Entity Name
 const StringRef &EntityBase::get_name() const { return this->name_; }
 void EntityBase::set_name(const char *name) {
@@ -75,6 +77,14 @@ void EntityBase::calc_object_id_() {
 
 uint32_t EntityBase::get_object_id_hash() { return this->object_id_hash_; }
 
+// State versions
+uint32_t EntityBase::get_state_epoch() {
+  static uint32_t epoch = 0;
+  while (epoch == 0)
+    epoch = random_uint32();
+  return epoch;
+}
+
 std::string EntityBase_DeviceClass::get_device_class() {
   if (this->device_class_ == nullptr) {
     return "";
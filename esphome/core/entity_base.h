@@ -47,6 +47,16 @@ class EntityBase {
   std::string get_icon() const;
   void set_icon(const char *icon);
 
+  // Get the state version of this entity: the global state version at its last state change, 0 if it didn't change
+  // since boot. Lets clients that reconnect only fetch the states that changed since they last saw them.
+  uint32_t get_state_version() const { return this->state_version_; }
+  // Record a state change of this entity, called by the components that forward states to clients.
+  void mark_state_changed() { this->state_version_ = ++global_state_version_; }
+  // Get the newest state version handed out to any entity.
+  static uint32_t get_global_state_version() { return global_state_version_; }
+  // Get a random, non-zero number identifying this boot, so state versions of an earlier boot are never reused.
+  static uint32_t get_state_epoch();
+
  protected:
   /// The hash_base() function has been deprecated. It is kept in this
   /// class for now, to prevent external components from not compiling.
@@ -57,10 +67,13 @@ class EntityBase {
   const char *object_id_c_str_{nullptr};
   const char *icon_c_str_{nullptr};
   uint32_t object_id_hash_;
+  uint32_t state_version_{0};
   bool has_own_name_{false};
   bool internal_{false};
   bool disabled_by_default_{false};
   EntityCategory entity_category_{ENTITY_CATEGORY_NONE};
+
+  static uint32_t global_state_version_;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 };
 
 class EntityBase_DeviceClass {  // NOLINT(readability-identifier-naming)
@@ -10,6 +10,8 @@ namespace esphome {
 static const char *const TAG = "scheduler";
 
 static const uint32_t MAX_LOGICALLY_DELETED_ITEMS = 10;
+// Number of finished items kept around for reuse; covers the usual debounce/script churn without holding on to memory
+static const size_t MAX_POOLED_ITEMS = 16;
 
 // Uncomment to debug scheduler
 // #define ESPHOME_DEBUG_SCHEDULER
@@ -23,34 +25,37 @@ void HOT Scheduler::set_timeout(Component *component, const std::string &name, u
                                 std::function<void()> func) {
   const uint32_t now = this->millis_();
 
+  const uint32_t name_hash = fnv1_hash(name);
   if (!name.empty())
-    this->cancel_timeout(component, name);
+    this->cancel_item_(component, name, name_hash, SchedulerItem::TIMEOUT);
 
   if (timeout == SCHEDULER_DONT_RUN)
     return;
 
   ESP_LOGVV(TAG, "set_timeout(name='%s', timeout=%" PRIu32 ")", name.c_str(), timeout);
 
-  auto item = make_unique<SchedulerItem>();
+  auto item = this->acquire_item_();
   item->component = component;
   item->name = name;
+  item->name_hash = name_hash;
   item->type = SchedulerItem::TIMEOUT;
   item->timeout = timeout;
   item->last_execution = now;
   item->last_execution_major = this->millis_major_;
   item->callback = std::move(func);
   item->remove = false;
-  this->push_(std::move(item));
+  this->add_item_(std::move(item));
 }
 bool HOT Scheduler::cancel_timeout(Component *component, const std::string &name) {
-  return this->cancel_item_(component, name, SchedulerItem::TIMEOUT);
+  return this->cancel_item_(component, name, fnv1_hash(name), SchedulerItem::TIMEOUT);
 }
 void HOT Scheduler::set_interval(Component *component, const std::string &name, uint32_t interval,
                                  std::function<void()> func) {
   const uint32_t now = this->millis_();
 
+  const uint32_t name_hash = fnv1_hash(name);
   if (!name.empty())
-    this->cancel_interval(component, name);
+    this->cancel_item_(component, name, name_hash, SchedulerItem::INTERVAL);
 
   if (interval == SCHEDULER_DONT_RUN)
     return;
@@ -62,9 +67,10 @@ void HOT Scheduler::set_interval(Component *component, const std::string &name,
 
   ESP_LOGVV(TAG, "set_interval(name='%s', interval=%" PRIu32 ", offset=%" PRIu32 ")", name.c_str(), interval, offset);
 
-  auto item = make_unique<SchedulerItem>();
+  auto item = this->acquire_item_();
   item->component = component;
   item->name = name;
+  item->name_hash = name_hash;
   item->type = SchedulerItem::INTERVAL;
   item->interval = interval;
   item->last_execution = now - offset - interval;
@@ -73,10 +79,10 @@ void HOT Scheduler::set_interval(Component *component, const std::string &name,
     item->last_execution_major--;
   item->callback = std::move(func);
   item->remove = false;
-  this->push_(std::move(item));
+  this->add_item_(std::move(item));
 }
 bool HOT Scheduler::cancel_interval(Component *component, const std::string &name) {
-  return this->cancel_item_(component, name, SchedulerItem::INTERVAL);
+  return this->cancel_item_(component, name, fnv1_hash(name), SchedulerItem::INTERVAL);
 }
 
 struct RetryArgs {
@@ -216,8 +222,13 @@ void HOT Scheduler::call() {
 
       // Don't run on failed components
       if (item->component != nullptr && item->component->is_failed()) {
-        LockGuard guard{this->lock_};
-        this->pop_raw_();
+        std::unique_ptr<SchedulerItem> failed;
+        {
+          LockGuard guard{this->lock_};
+          failed = std::move(this->items_[0]);
+          this->pop_raw_();
+        }
+        this->recycle_item_(std::move(failed));
         continue;
       }
 
@@ -231,7 +242,15 @@ void HOT Scheduler::call() {
       //  - timeouts/intervals get cancelled
       {
         WarnIfComponentBlockingGuard guard{item->component};
+#ifdef USE_COMPONENT_RUNTIME_STATS
+        Component *component = item->component;
+        const uint32_t start = micros();
+        item->callback();
+        if (component != nullptr)
+          component->get_scheduler_stats().record(micros() - start);
+#else
         item->callback();
+#endif
       }
     }
 
@@ -250,6 +269,7 @@ void HOT Scheduler::call() {
       if (item->remove) {
         // We were removed/cancelled in the function call, stop
         to_remove_--;
+        this->recycle_item_(std::move(item));
         continue;
       }
 
@@ -262,6 +282,8 @@ void HOT Scheduler::call() {
             item->last_execution_major++;
         }
         this->push_(std::move(item));
+      } else {
+        this->recycle_item_(std::move(item));
       }
     }
   }
@@ -272,9 +294,14 @@ void HOT Scheduler::process_to_add() {
   LockGuard guard{this->lock_};
   for (auto &it : this->to_add_) {
     if (it->remove) {
+      if (this->item_pool_.size() < MAX_POOLED_ITEMS) {
+        it->callback = nullptr;
+        this->item_pool_.push_back(std::move(it));
+      }
       continue;
     }
 
+    it->pending = false;
     this->items_.push_back(std::move(it));
     std::push_heap(this->items_.begin(), this->items_.end(), SchedulerItem::cmp);
   }
@@ -282,16 +309,19 @@ void HOT Scheduler::process_to_add() {
 }
 void HOT Scheduler::cleanup_() {
   while (!this->items_.empty()) {
-    auto &item = this->items_[0];
-    if (!item->remove)
+    auto &front = this->items_[0];
+    if (!front->remove)
       return;
 
     to_remove_--;
 
+    std::unique_ptr<SchedulerItem> item;
     {
       LockGuard guard{this->lock_};
+      item = std::move(this->items_[0]);
       this->pop_raw_();
     }
+    this->recycle_item_(std::move(item));
   }
 }
 void HOT Scheduler::pop_raw_() {
@@ -300,28 +330,96 @@ void HOT Scheduler::pop_raw_() {
 }
 void HOT Scheduler::push_(std::unique_ptr<Scheduler::SchedulerItem> item) {
   LockGuard guard{this->lock_};
+  item->pending = true;
+  this->to_add_.push_back(std::move(item));
+}
+void HOT Scheduler::add_item_(std::unique_ptr<Scheduler::SchedulerItem> item) {
+  LockGuard guard{this->lock_};
+  item->index_next = nullptr;
+  item->index_prev = nullptr;
+  if (!item->name.empty()) {
+    SchedulerItem **bucket = this->index_bucket_(item->component, item->name_hash, item->type);
+    item->index_next = *bucket;
+    if (item->index_next != nullptr)
+      item->index_next->index_prev = &item->index_next;
+    item->index_prev = bucket;
+    *bucket = item.get();
+  }
+  item->pending = true;
   this->to_add_.push_back(std::move(item));
 }
-bool HOT Scheduler::cancel_item_(Component *component, const std::string &name, Scheduler::SchedulerItem::Type type) {
+std::unique_ptr<Scheduler::SchedulerItem> HOT Scheduler::acquire_item_() {
+  {
+    LockGuard guard{this->lock_};
+    if (!this->item_pool_.empty()) {
+      auto item = std::move(this->item_pool_.back());
+      this->item_pool_.pop_back();
+      return item;
+    }
+  }
+  return make_unique<SchedulerItem>();
+}
+void HOT Scheduler::recycle_item_(std::unique_ptr<Scheduler::SchedulerItem> item) {
+  // Release whatever the callback captured now rather than when the item is reused
+  item->callback = nullptr;
+  LockGuard guard{this->lock_};
+  // Finished timeouts and items of failed components are still indexed, cancelled ones aren't
+  this->unindex_item_(item.get());
+  if (this->item_pool_.size() < MAX_POOLED_ITEMS)
+    this->item_pool_.push_back(std::move(item));
+}
+bool HOT Scheduler::cancel_item_(Component *component, const std::string &name, uint32_t name_hash,
+                                 Scheduler::SchedulerItem::Type type) {
   // obtain lock because this function iterates and can be called from non-loop task context
   LockGuard guard{this->lock_};
   bool ret = false;
-  for (auto &it : this->items_) {
-    if (it->component == component && it->name == name && it->type == type && !it->remove) {
-      to_remove_++;
-      it->remove = true;
-      ret = true;
+  if (name.empty()) {
+    // Anonymous items aren't indexed, only DelayAction::stop() cancels them all at once
+    for (auto &it : this->items_) {
+      if (it->component == component && it->name.empty() && it->type == type && !it->remove) {
+        to_remove_++;
+        it->remove = true;
+        ret = true;
+      }
     }
-  }
-  for (auto &it : this->to_add_) {
-    if (it->component == component && it->name == name && it->type == type) {
-      it->remove = true;
-      ret = true;
+    for (auto &it : this->to_add_) {
+      if (it->component == component && it->name.empty() && it->type == type) {
+        it->remove = true;
+        ret = true;
+      }
     }
+    return ret;
   }
 
+  SchedulerItem *next;
+  for (SchedulerItem *item = *this->index_bucket_(component, name_hash, type); item != nullptr; item = next) {
+    next = item->index_next;
+    if (item->component != component || item->type != type || item->name_hash != name_hash || item->name != name)
+      continue;
+    // Items in `to_add_` are dropped by process_to_add() without being counted
+    if (!item->pending)
+      to_remove_++;
+    item->remove = true;
+    ret = true;
+    this->unindex_item_(item);
+  }
   return ret;
 }
+Scheduler::SchedulerItem **Scheduler::index_bucket_(Component *component, uint32_t name_hash,
+                                                    Scheduler::SchedulerItem::Type type) {
+  const uint32_t component_hash = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(component)) * 2654435761UL;
+  const uint32_t key = name_hash ^ component_hash ^ type;
+  return &this->index_[(key ^ (key >> 16)) % SCHEDULER_INDEX_BUCKETS];
+}
+void Scheduler::unindex_item_(SchedulerItem *item) {
+  if (item->index_prev == nullptr)
+    return;
+  *item->index_prev = item->index_next;
+  if (item->index_next != nullptr)
+    item->index_next->index_prev = item->index_prev;
+  item->index_next = nullptr;
+  item->index_prev = nullptr;
+}
 uint32_t Scheduler::millis_() {
   const uint32_t now = millis();
   if (now < this->last_millis_) {
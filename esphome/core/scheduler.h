@@ -10,6 +10,9 @@ namespace esphome {
 
 class Component;
 
+/// Number of buckets of the scheduler's index of named items.
+static const uint8_t SCHEDULER_INDEX_BUCKETS = 32;
+
 class Scheduler {
  public:
   void set_timeout(Component *component, const std::string &name, uint32_t timeout, std::function<void()> func);
@@ -31,6 +34,8 @@ class Scheduler {
   struct SchedulerItem {
     Component *component;
     std::string name;
+    // fnv1 hash of `name`, selects the bucket of the item in `index_`
+    uint32_t name_hash;
     enum Type { TIMEOUT, INTERVAL } type;
     union {
       uint32_t interval;
@@ -39,6 +44,12 @@ class Scheduler {
     uint32_t last_execution;
     std::function<void()> callback;
     bool remove;
+    // Whether the item is in `to_add_` rather than `items_`
+    bool pending;
+    // Next item in the same bucket of `index_`
+    SchedulerItem *index_next;
+    // The pointer to this item in its bucket of `index_`, nullptr if the item isn't indexed
+    SchedulerItem **index_prev;
     uint8_t last_execution_major;
 
     inline uint32_t next_execution() { return this->last_execution + this->timeout; }
@@ -67,7 +78,16 @@ class Scheduler {
   void cleanup_();
   void pop_raw_();
   void push_(std::unique_ptr<SchedulerItem> item);
-  bool cancel_item_(Component *component, const std::string &name, SchedulerItem::Type type);
+  /// Schedule a new item and add it to `index_` if it has a name.
+  void add_item_(std::unique_ptr<SchedulerItem> item);
+  /// Get an item from the pool of recycled items, or allocate a new one if the pool is empty.
+  std::unique_ptr<SchedulerItem> acquire_item_();
+  /// Return an item that was removed from `items_` to the pool so its storage can be reused.
+  void recycle_item_(std::unique_ptr<SchedulerItem> item);
+  bool cancel_item_(Component *component, const std::string &name, uint32_t name_hash, SchedulerItem::Type type);
+  SchedulerItem **index_bucket_(Component *component, uint32_t name_hash, SchedulerItem::Type type);
+  /// Remove the item from `index_` if it is in there, the lock must be held.
+  void unindex_item_(SchedulerItem *item);
   bool empty_() {
     this->cleanup_();
     return this->items_.empty();
@@ -76,6 +96,12 @@ class Scheduler {
   Mutex lock_;
   std::vector<std::unique_ptr<SchedulerItem>> items_;
   std::vector<std::unique_ptr<SchedulerItem>> to_add_;
+  std::vector<std::unique_ptr<SchedulerItem>> item_pool_;
+  /** The named items in `items_` and `to_add_` that aren't cancelled, so cancelling doesn't have to scan them.
+   *
+   * A fixed hash table whose buckets chain the items through their `index_next` field, so indexing doesn't allocate.
+   */
+  SchedulerItem *index_[SCHEDULER_INDEX_BUCKETS]{};
   uint32_t last_millis_{0};
   uint8_t millis_major_{0};
   uint32_t to_remove_{0};
@@ -66,6 +66,7 @@ class StringRef {
   const_reverse_iterator crend() const { return const_reverse_iterator{base_}; }
 
   constexpr const char *c_str() const { return base_; }
+  constexpr const char *data() const { return base_; }
   constexpr size_type size() const { return len_; }
   constexpr bool empty() const { return len_ == 0; }
   constexpr const_reference operator[](size_type pos) const { return *(base_ + pos); }
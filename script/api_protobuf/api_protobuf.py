@@ -316,6 +316,18 @@ class StringType(TypeInfo):
         return o
 
 
+class StringRefType(StringType):
+    """String or bytes field of a message that is only ever received.
+
+    Decoded as a view into the receive buffer, so decoding does not allocate.
+    """
+
+    cpp_type = "StringRef"
+    reference_type = "StringRef &"
+    const_reference_type = "const StringRef &"
+    decode_length = "value.as_string_ref()"
+
+
 @register_type(11)
 class MessageType(TypeInfo):
     @property
@@ -571,9 +583,15 @@ def build_message_type(desc):
     encode = []
     dump = []
 
+    # Client-only messages are decoded and handled in place, so their strings can
+    # borrow from the receive buffer instead of being copied.
+    borrow_strings = get_opt(desc, pb.source, SOURCE_BOTH) == SOURCE_CLIENT
+
     for field in desc.field:
         if field.label == 3:
             ti = RepeatedTypeInfo(field)
+        elif borrow_strings and field.type in (9, 12):
+            ti = StringRefType(field)
         else:
             ti = TYPE_INFO[field.type](field)
         protected_content.extend(ti.protected_content)
@@ -0,0 +1,113 @@
+"""Tests for the compression of image and animation data."""
+
+import random
+
+from esphome.components.image.compression import (
+    KEY_FRAME_FLAG,
+    KEY_FRAME_INTERVAL,
+    MAX_RUN,
+    RUN_REPEAT,
+    RUN_UNCHANGED,
+    compress_animation,
+    compress_image,
+    encode_row,
+)
+
+
+def decode_rows(data, pos, stride, height, unit, rows):
+    """Decode height rows starting at pos on top of rows, like image::RowDecoder."""
+    for y in range(height):
+        x = 0
+        while x < stride:
+            header = data[pos]
+            pos += 1
+            length = ((header & 0x3F) + 1) * unit
+            if header & 0xC0 == RUN_REPEAT:
+                rows[y][x : x + length] = data[pos : pos + unit] * (length // unit)
+                pos += unit
+            elif header & 0xC0 != RUN_UNCHANGED:
+                rows[y][x : x + length] = data[pos : pos + length]
+                pos += length
+            x += length
+    return pos
+
+
+def decode_animation(data, stride, height, frames, unit):
+    rows = [[0] * stride for _ in range(height)]
+    result = []
+    for frame in range(frames):
+        entry = int.from_bytes(bytes(data[frame * 4 : frame * 4 + 4]), "little")
+        decode_rows(data, entry & ~KEY_FRAME_FLAG, stride, height, unit, rows)
+        result += [value for row in rows for value in row]
+    return result
+
+
+def random_image(stride, height, seed):
+    rand = random.Random(seed)
+    return [
+        rand.choice([0, 0, 0, 0x55, rand.randrange(256)])
+        for _ in range(stride * height)
+    ]
+
+
+def test_encode_row_uses_repeat_and_unchanged_runs():
+    """
+    Runs of the same pixel and of pixels unchanged from the previous frame take a
+    header per MAX_RUN pixels
+    """
+    # Given
+    row = bytes([1, 2] * 100 + [3, 4])
+    previous = bytes([1, 2] * 100 + [5, 6])
+
+    # When
+    key = encode_row(row, 2)
+    delta = encode_row(row, 2, previous)
+
+    # Then
+    assert key == [RUN_REPEAT | (MAX_RUN - 1), 1, 2, RUN_REPEAT | 35, 1, 2, 0, 3, 4]
+    assert delta == [RUN_UNCHANGED | (MAX_RUN - 1), RUN_UNCHANGED | 35, 0, 3, 4]
+
+
+def test_compress_image_round_trip():
+    """
+    Decoding a compressed image gives back its data, for every unit size
+    """
+    for unit in (1, 2, 3, 4):
+        # Given
+        stride = 37 * unit
+        data = random_image(stride, 20, unit)
+        rows = [[0] * stride for _ in range(20)]
+
+        # When
+        compressed = compress_image(data, stride, 20, unit)
+        end = decode_rows(compressed, 0, stride, 20, unit, rows)
+
+        # Then
+        assert end == len(compressed)
+        assert [value for row in rows for value in row] == data
+
+
+def test_compress_animation_round_trip():
+    """
+    Decoding the frames of a compressed animation on top of each other gives back
+    its data
+    """
+    # Given
+    stride, height, frames, unit = 60, 10, KEY_FRAME_INTERVAL * 2 + 3, 3
+    rand = random.Random(1)
+    data = random_image(stride, height, 0)
+    for _ in range(frames - 1):
+        frame = data[-stride * height :]
+        for _ in range(20):
+            frame[rand.randrange(len(frame))] = rand.randrange(256)
+        data += frame
+
+    # When
+    compressed = compress_animation(data, stride, height, frames, unit)
+
+    # Then
+    assert decode_animation(compressed, stride, height, frames, unit) == data
+    assert len(compressed) < len(data) / 2
+    for frame in range(frames):
+        flags = compressed[frame * 4 + 3] & 0x80
+        assert bool(flags) == (frame % KEY_FRAME_INTERVAL == 0)